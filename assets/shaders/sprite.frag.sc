@@ -1,12 +1,40 @@
 $input v_texcoord0, v_color0
 
+// Variants (compile_shaders passes at most one color source plus alpha test):
+//   SPRITE_SOLID       vertex color only, output premultiplied
+//   SPRITE_FLASH       vertex color masked by texture alpha, output premultiplied
+//   SPRITE_PALETTE     texture red channel indexes a 256x1 palette
+//   SPRITE_ALPHA_TEST  discard alpha < 0.5
+
 #include <bgfx_shader.sh>
 
+#ifndef SPRITE_SOLID
 SAMPLER2D(s_texture, 0);
+#endif
+#ifdef SPRITE_PALETTE
+SAMPLER2D(s_palette, 1);
+#endif
 
 void main()
 {
-    vec4 texColor = texture2D(s_texture, v_texcoord0);
-    gl_FragColor = texColor * v_color0;
-}
+#if defined(SPRITE_SOLID)
+    vec4 color = vec4(v_color0.rgb * v_color0.a, v_color0.a);
+#elif defined(SPRITE_FLASH)
+    float alpha = v_color0.a * texture2D(s_texture, v_texcoord0).a;
+    vec4 color = vec4(v_color0.rgb * alpha, alpha);
+#elif defined(SPRITE_PALETTE)
+    float index = texture2D(s_texture, v_texcoord0).r;
+    vec4 color = texture2D(s_palette, vec2(index * (255.0 / 256.0) + 0.5 / 256.0, 0.5)) * v_color0;
+#else
+    vec4 color = texture2D(s_texture, v_texcoord0) * v_color0;
+#endif
 
+#ifdef SPRITE_ALPHA_TEST
+    if (color.a < 0.5)
+    {
+        discard;
+    }
+#endif
+
+    gl_FragColor = color;
+}
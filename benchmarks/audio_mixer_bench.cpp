@@ -0,0 +1,227 @@
+// Offline audio mixer benchmark.
+// Mixes through AudioEngine's null backend as fast as possible and prints
+// JSON results (stdout or --output <file>) for CI regression tracking.
+//
+//   AudioMixerBench [--seconds <audio seconds per case>] [--output <file>] [--quick]
+#include "audio/audio_engine.h"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+using json = nlohmann::json;
+
+namespace {
+
+constexpr uint32_t kSampleRate = 44100;
+constexpr uint32_t kBlockFrames = 1024;
+constexpr float kPi = 3.14159265358979f;
+
+struct Options {
+    double seconds = 4.0;
+    std::string output;
+    bool quick = false;
+};
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            options.output = argv[++i];
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            options.quick = true;
+            options.seconds = 1.0;
+        }
+    }
+    return options;
+}
+
+void writeU16(std::ofstream& out, uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); }
+void writeU32(std::ofstream& out, uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); }
+
+// 16-bit PCM sine tone as a RIFF/WAVE file (little-endian hosts)
+std::string writeToneWav(const std::filesystem::path& dir, const std::string& name,
+                         uint32_t sampleRate, uint16_t channels, double seconds) {
+    const std::filesystem::path path = dir / (name + ".wav");
+    const uint32_t frames = static_cast<uint32_t>(seconds * sampleRate);
+    const uint32_t dataBytes = frames * channels * 2;
+
+    std::ofstream out(path, std::ios::binary);
+    out.write("RIFF", 4);
+    writeU32(out, 36 + dataBytes);
+    out.write("WAVEfmt ", 8);
+    writeU32(out, 16);
+    writeU16(out, 1);  // PCM
+    writeU16(out, channels);
+    writeU32(out, sampleRate);
+    writeU32(out, sampleRate * channels * 2);
+    writeU16(out, static_cast<uint16_t>(channels * 2));
+    writeU16(out, 16);
+    out.write("data", 4);
+    writeU32(out, dataBytes);
+
+    for (uint32_t i = 0; i < frames; ++i) {
+        const float t = static_cast<float>(i) / static_cast<float>(sampleRate);
+        const int16_t sample = static_cast<int16_t>(std::sin(2.0f * kPi * 440.0f * t) * 8000.0f);
+        for (uint16_t c = 0; c < channels; ++c) {
+            out.write(reinterpret_cast<const char*>(&sample), 2);
+        }
+    }
+    return path.string();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Mixes `audioSeconds` of output and returns the wall time it took.
+double mixFor(AudioEngine& audio, double audioSeconds) {
+    std::vector<float> buffer(kBlockFrames * audio.getChannels());
+    const uint64_t totalFrames = static_cast<uint64_t>(audioSeconds * audio.getSampleRate());
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t mixed = 0; mixed < totalFrames; mixed += kBlockFrames) {
+        audio.mixOffline(buffer.data(), kBlockFrames);
+    }
+    return secondsSince(start);
+}
+
+bool initNull(AudioEngine& audio, uint32_t maxVoices) {
+    AudioConfig config;
+    config.backend = AudioBackend::Null;
+    config.sampleRate = kSampleRate;
+    config.bufferSize = kBlockFrames;
+    config.maxVoices = maxVoices;
+    return audio.init(config);
+}
+
+json mixResult(AudioEngine& audio, uint32_t voices, double audioSeconds, double wall) {
+    const double frames = audioSeconds * audio.getSampleRate();
+    json result;
+    result["voices"] = voices;
+    result["active_voices"] = audio.getVoiceStats().activeVoices;
+    result["audio_seconds"] = audioSeconds;
+    result["wall_seconds"] = wall;
+    result["realtime_factor"] = wall > 0.0 ? audioSeconds / wall : 0.0;
+    result["ns_per_frame"] = wall * 1e9 / frames;
+    result["ns_per_voice_frame"] = voices > 0 ? wall * 1e9 / (frames * voices) : 0.0;
+    return result;
+}
+
+json benchVoiceScaling(const std::filesystem::path& dir, const Options& options) {
+    const std::string tone = writeToneWav(dir, "tone_44k", kSampleRate, 1, options.seconds + 1.0);
+    const std::vector<uint32_t> counts = options.quick
+        ? std::vector<uint32_t>{1, 32, 128}
+        : std::vector<uint32_t>{1, 8, 16, 32, 64, 128, 255};
+
+    json results = json::array();
+    for (uint32_t count : counts) {
+        AudioEngine audio;
+        if (!initNull(audio, count)) continue;
+        SoundId id = audio.loadSound("tone", tone);
+        for (uint32_t i = 0; i < count; ++i) {
+            audio.playSound(id, 0.5f, (static_cast<float>(i % 5) - 2.0f) * 0.5f);
+        }
+        results.push_back(mixResult(audio, count, options.seconds, mixFor(audio, options.seconds)));
+    }
+    return results;
+}
+
+json benchResampling(const std::filesystem::path& dir, const Options& options) {
+    constexpr uint32_t kVoices = 32;
+    struct Case { const char* name; uint32_t sourceRate; uint16_t channels; };
+    const Case cases[] = {
+        {"native_mono_44100", 44100, 1},
+        {"native_stereo_44100", 44100, 2},
+        {"resample_mono_22050", 22050, 1},
+        {"resample_mono_48000", 48000, 1},
+    };
+
+    json results = json::array();
+    for (const Case& c : cases) {
+        const std::string path = writeToneWav(dir, c.name, c.sourceRate, c.channels, options.seconds + 1.0);
+        AudioEngine audio;
+        if (!initNull(audio, kVoices)) continue;
+        SoundId id = audio.loadSound(c.name, path);
+        for (uint32_t i = 0; i < kVoices; ++i) {
+            audio.playSound(id, 0.5f);
+        }
+        json result = mixResult(audio, kVoices, options.seconds, mixFor(audio, options.seconds));
+        result["case"] = c.name;
+        result["source_rate"] = c.sourceRate;
+        results.push_back(result);
+    }
+    return results;
+}
+
+json benchDecode(const std::filesystem::path& dir, const Options& options) {
+    const double trackSeconds = options.quick ? 10.0 : 30.0;
+    const std::string track = writeToneWav(dir, "track", kSampleRate, 2, trackSeconds);
+    const double fileBytes = static_cast<double>(std::filesystem::file_size(track));
+
+    json results;
+    AudioEngine audio;
+    if (!initNull(audio, 4)) return results;
+
+    // Full decode into memory (Wav)
+    auto start = std::chrono::steady_clock::now();
+    audio.loadSound("track", track);
+    const double decodeWall = secondsSince(start);
+    results["wav_decode"] = {
+        {"audio_seconds", trackSeconds},
+        {"wall_seconds", decodeWall},
+        {"mb_per_second", decodeWall > 0.0 ? fileBytes / decodeWall / (1024.0 * 1024.0) : 0.0},
+    };
+
+    // Streaming decode while mixing (WavStream, prefetched on a worker)
+    audio.loadMusic("track", track);
+    while (!audio.isMusicReady("track")) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        audio.update();
+    }
+    audio.playMusic("track", 1.0f, true);
+    const double streamWall = mixFor(audio, trackSeconds);
+    json stream = mixResult(audio, 1, trackSeconds, streamWall);
+    stream["mb_per_second"] = streamWall > 0.0 ? fileBytes / streamWall / (1024.0 * 1024.0) : 0.0;
+    results["stream_decode"] = stream;
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "engine_audio_bench";
+    std::filesystem::create_directories(dir);
+
+    json report;
+    report["benchmark"] = "audio_mixer";
+    report["sample_rate"] = kSampleRate;
+    report["block_frames"] = kBlockFrames;
+    report["audio_seconds_per_case"] = options.seconds;
+    report["voice_scaling"] = benchVoiceScaling(dir, options);
+    report["resampling"] = benchResampling(dir, options);
+    report["decode"] = benchDecode(dir, options);
+
+    std::filesystem::remove_all(dir);
+
+    const std::string text = report.dump(2);
+    if (options.output.empty()) {
+        std::cout << text << std::endl;
+    } else {
+        std::ofstream out(options.output);
+        out << text << std::endl;
+        std::fprintf(stderr, "Audio benchmark written to %s\n", options.output.c_str());
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "animation_controller.h"
+#include "core/memory_tracker.h"
 #include <algorithm>
 #include <stdexcept>
 
@@ -72,6 +73,7 @@ void AnimationController::update(float dt) {
     if (!playing || paused || !current_anim || finished) {
         return;
     }
+    MemoryTagScope memoryTag(MemoryTag::Animation);
     
     // Apply playback speed
     dt *= playback_speed;
@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Engine {
+
+// Interned sound identifier (index into AudioEngine's sound table)
+using SoundId = uint32_t;
+// Engine-side voice identifier, allocated by the producer before the voice exists
+using VoiceId = uint32_t;
+
+constexpr SoundId kInvalidSoundId = UINT32_MAX;
+constexpr VoiceId kInvalidVoiceId = 0;
+
+enum class AudioCommandType : uint8_t {
+    Play,
+    PlayAt,
+    Stop,
+    SetVolume,
+    SetPan,
+    SetPosition
+};
+
+struct AudioCommand {
+    AudioCommandType type = AudioCommandType::Play;
+    SoundId sound = kInvalidSoundId;
+    VoiceId voice = kInvalidVoiceId;
+    float volume = 1.0f;
+    float pan = 0.0f;
+    float x = 0.0f;  // World position for PlayAt / SetPosition
+    float y = 0.0f;
+};
+
+// Bounded lock-free multi-producer / single-consumer queue.
+// Any thread may push; only the audio update step pops.
+class AudioCommandQueue {
+public:
+    explicit AudioCommandQueue(size_t capacity = 1024);  // Rounded up to a power of two
+
+    AudioCommandQueue(const AudioCommandQueue&) = delete;
+    AudioCommandQueue& operator=(const AudioCommandQueue&) = delete;
+
+    // Producer side (thread-safe). Returns false if the queue is full.
+    bool push(const AudioCommand& command);
+
+    // Consumer side (single thread only)
+    bool pop(AudioCommand& command);
+    template <typename Fn>
+    size_t drain(Fn&& apply);
+
+    size_t capacity() const { return mask + 1; }
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        AudioCommand command;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos = 0;
+    std::atomic<uint64_t> dropped{0};
+};
+
+template <typename Fn>
+size_t AudioCommandQueue::drain(Fn&& apply) {
+    size_t count = 0;
+    AudioCommand command;
+    while (pop(command)) {
+        apply(command);
+        ++count;
+    }
+    return count;
+}
+
+} // namespace Engine
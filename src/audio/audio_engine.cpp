@@ -1,82 +1,675 @@
 #include "audio_engine.h"
+#include "core/memory_tracker.h"
 #include "platform/logging.h"
+#include "rendering/camera.h"
+#include <algorithm>
+#include <chrono>
+#include <utility>
 
 namespace Engine {
 
-void AudioEngine::init() {
-    soloud.init();
-    Log::info("SoLoud audio initialized");
+namespace {
+// SoLoud mixes at most 255 voices at once; the rest are virtual.
+constexpr uint32_t kMaxMixedVoices = 255;
+constexpr uint32_t kNullSampleRate = 44100;
+constexpr uint32_t kNullBufferSize = 2048;
+
+size_t decodedSize(const SoLoud::Wav& wav) {
+    return static_cast<size_t>(wav.mSampleCount) * wav.mChannels * sizeof(float);
+}
+} // namespace
+
+bool AudioEngine::init(const AudioConfig& config) {
+    if (initialized) {
+        shutdown();
+    }
+
+    SoLoud::result result = SoLoud::UNKNOWN_ERROR;
+    if (config.backend == AudioBackend::Default) {
+        result = soloud.init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::AUTO,
+                             config.sampleRate, config.bufferSize, config.channels);
+        if (result != SoLoud::SO_NO_ERROR) {
+            Log::warn("Audio device init failed (error: {}){}", result,
+                      config.fallbackToNull ? ", using null backend" : "");
+        } else {
+            backend = AudioBackend::Default;
+        }
+    }
+
+    if (result != SoLoud::SO_NO_ERROR &&
+        (config.backend == AudioBackend::Null || config.fallbackToNull)) {
+        // The null driver never pulls audio itself; the mixer runs only in mixOffline().
+        result = soloud.init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::NULLDRIVER,
+                             config.sampleRate ? config.sampleRate : kNullSampleRate,
+                             config.bufferSize ? config.bufferSize : kNullBufferSize,
+                             config.channels);
+        backend = AudioBackend::Null;
+    }
+
+    if (result != SoLoud::SO_NO_ERROR) {
+        Log::error("Failed to initialize SoLoud (error: {})", result);
+        return false;
+    }
+
+    sampleRate = soloud.getBackendSamplerate();
+    channels = soloud.getBackendChannels();
+    voicePool.setMaxVoices(config.maxVoices);
+    soloud.setMaxActiveVoiceCount(std::clamp(config.maxVoices, 1u, kMaxMixedVoices));
+    initialized = true;
+    Log::info("SoLoud audio initialized: {} ({} Hz, {} channels, voice budget: {})",
+              isOffline() ? "null" : soloud.getBackendString(), sampleRate, channels, config.maxVoices);
+    return true;
+}
+
+uint32_t AudioEngine::mixOffline(float* buffer, uint32_t frames) {
+    if (!initialized || !isOffline() || !buffer) return 0;
+    soloud.mix(buffer, frames);
+    return frames;
 }
 
 void AudioEngine::shutdown() {
+    if (!initialized) return;
+    for (auto& pending : pendingBanks) {
+        pending.result.wait();
+    }
+    pendingBanks.clear();
+    for (auto& [name, track] : music) {
+        if (track.prefetch.valid()) track.prefetch.wait();
+    }
+    pendingMusic = PendingMusic{};
+    currentMusicHandle = 0;
+    fadingMusicHandle = 0;
     soloud.deinit();
+    voicePool.clear();
+    voiceHandles.clear();
+    spatialVoices.clear();
+    initialized = false;
     Log::info("SoLoud audio shutdown");
 }
 
-void AudioEngine::loadSound(const std::string& name, const std::string& path) {
-    SoLoud::Wav wav;
-    SoLoud::result result = wav.load(path.c_str());
+void AudioEngine::update() {
+    MemoryTagScope memoryTag(MemoryTag::Audio);
+    pollPendingBanks();
+    pollMusic();
+    commands.drain([this](const AudioCommand& command) { applyCommand(command); });
+    pruneVoices();
+    updateSpatialVoices();
+}
+
+SoundId AudioEngine::loadSound(const std::string& name, const std::string& path) {
+    MemoryTagScope memoryTag(MemoryTag::Audio);
+    std::unique_ptr<SoundEntry> entry = std::make_unique<SoundEntry>();
+    entry->wav = std::make_unique<SoLoud::Wav>();
+    SoLoud::result result = entry->wav->load(path.c_str());
     
     if (result != SoLoud::SO_NO_ERROR) {
         Log::error("Failed to load sound: {} (error: {})", path, result);
-        return;
+        return getSoundId(name);
     }
     
-    sounds[name] = std::move(wav);
-    Log::info("Sound loaded: {}", name);
+    SoundId id = registerSound(name, std::move(entry));
+    Log::info("Sound loaded: {} (id {})", name, id);
+    return id;
 }
 
-void AudioEngine::playSound(const std::string& name, float volume) {
-    auto it = sounds.find(name);
-    if (it != sounds.end()) {
-        soloud.play(it->second, volume);
+SoundId AudioEngine::registerSound(const std::string& name, std::unique_ptr<SoundEntry> entry) {
+    // Reload into an existing slot so ids handed out earlier stay valid.
+    SoundId id = getSoundId(name);
+    if (id == kInvalidSoundId) {
+        id = static_cast<SoundId>(sounds.size());
+        sounds.push_back(std::move(entry));
+        soundIds[name] = id;
     } else {
+        SoundEntry& old = *sounds[id];
+        entry->group = old.group;
+        if (old.wav) soloud.stopAudioSource(*old.wav);
+        if (old.stream) soloud.stopAudioSource(*old.stream);
+        clipCache.erase(id);
+        sounds[id] = std::move(entry);
+    }
+
+    // Only bank clips can be decoded again, so only they are evictable.
+    SoundEntry& stored = *sounds[id];
+    if (stored.bank && stored.wav) {
+        clipCache.insert(id, decodedSize(*stored.wav));
+    }
+    return id;
+}
+
+SoLoud::AudioSource* AudioEngine::acquireSource(SoundId sound) {
+    SoundEntry& entry = *sounds[sound];
+    if (entry.stream) {
+        return entry.stream.get();
+    }
+
+    if (!entry.wav && entry.bank && entry.clip) {
+        // Evicted or never preloaded: decode from the bank bytes now.
+        auto wav = std::make_unique<SoLoud::Wav>();
+        SoLoud::result result = wav->loadMem(entry.bank->getClipData(*entry.clip), entry.clip->size, false, false);
+        if (result != SoLoud::SO_NO_ERROR) {
+            Log::error("Failed to decode bank clip: {} (error: {})", entry.clip->name, result);
+            return nullptr;
+        }
+        entry.wav = std::move(wav);
+        clipCache.insert(sound, decodedSize(*entry.wav));
+    } else {
+        clipCache.touch(sound);
+    }
+
+    evictDecodedClips(sound);
+    return entry.wav.get();
+}
+
+void AudioEngine::evictDecodedClips(SoundId keep) {
+    // Clips with live voices stay resident; the budget is soft while they play.
+    std::vector<ClipCache::Key> evicted = clipCache.evict([this, keep](ClipCache::Key key) {
+        return key != keep && soloud.countAudioSource(*sounds[key]->wav) == 0;
+    });
+    for (ClipCache::Key key : evicted) {
+        sounds[key]->wav.reset();
+    }
+}
+
+bool AudioEngine::loadSoundBank(const std::string& path) {
+    std::unique_ptr<LoadedBank> loaded = readBank(path);
+    if (!loaded) return false;
+    registerBank(path, std::move(loaded));
+    return true;
+}
+
+void AudioEngine::loadSoundBankAsync(const std::string& path) {
+    pendingBanks.push_back({path, std::async(std::launch::async, &AudioEngine::readBank, path)});
+}
+
+void AudioEngine::setSoundMemoryBudget(size_t bytes) {
+    clipCache.setBudget(bytes);
+    evictDecodedClips(kInvalidSoundId);
+}
+
+std::unique_ptr<AudioEngine::LoadedBank> AudioEngine::readBank(const std::string& path) {
+    // Runs on a worker thread: touches only objects not yet shared with the mixer.
+    MemoryTagScope memoryTag(MemoryTag::Audio);
+    auto bank = std::make_shared<SoundBank>();
+    if (!bank->loadFromFile(path)) {
+        return nullptr;
+    }
+
+    auto loaded = std::make_unique<LoadedBank>();
+    loaded->bank = bank;
+    for (const SoundBankClip& clip : bank->getClips()) {
+        auto entry = std::make_unique<SoundEntry>();
+        entry->bank = bank;
+        entry->clip = &clip;
+
+        const uint8_t* bytes = bank->getClipData(clip);
+        SoLoud::result result = SoLoud::SO_NO_ERROR;
+        if (clip.isCompressed()) {
+            entry->stream = std::make_unique<SoLoud::WavStream>();
+            result = entry->stream->loadMem(bytes, clip.size, false, false);
+        } else if (clip.isPreload()) {
+            entry->wav = std::make_unique<SoLoud::Wav>();
+            result = entry->wav->loadMem(bytes, clip.size, false, false);
+        }
+
+        if (result != SoLoud::SO_NO_ERROR) {
+            Log::error("Failed to decode bank clip: {} (error: {})", clip.name, result);
+            entry.reset();
+        }
+        loaded->entries.push_back(std::move(entry));
+    }
+    return loaded;
+}
+
+void AudioEngine::registerBank(const std::string& path, std::unique_ptr<LoadedBank> loaded) {
+    size_t registered = 0;
+    for (auto& entry : loaded->entries) {
+        if (!entry) continue;
+        const std::string name = entry->clip->name;
+        registerSound(name, std::move(entry));
+        ++registered;
+    }
+
+    evictDecodedClips(kInvalidSoundId);
+    Log::info("Sound bank registered: {} ({} clips, {} bytes decoded)", path, registered, clipCache.getUsedBytes());
+}
+
+void AudioEngine::pollPendingBanks() {
+    for (auto it = pendingBanks.begin(); it != pendingBanks.end();) {
+        if (it->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+        std::unique_ptr<LoadedBank> loaded = it->result.get();
+        if (loaded) {
+            registerBank(it->path, std::move(loaded));
+        } else {
+            Log::error("Async sound bank load failed: {}", it->path);
+        }
+        it = pendingBanks.erase(it);
+    }
+}
+
+SoundId AudioEngine::getSoundId(const std::string& name) const {
+    auto it = soundIds.find(name);
+    return it != soundIds.end() ? it->second : kInvalidSoundId;
+}
+
+SoLoud::handle AudioEngine::playSound(const std::string& name, float volume) {
+    SoundId id = getSoundId(name);
+    if (id == kInvalidSoundId) {
         Log::warn("Sound not found: {}", name);
+        return 0;
+    }
+    return playSound(id, volume);
+}
+
+SoLoud::handle AudioEngine::playSound(SoundId sound, float volume, float pan) {
+    if (sound >= sounds.size()) {
+        Log::warn("Invalid sound id: {}", sound);
+        return 0;
+    }
+    return startVoice(sound, volume, pan, 1.0f);
+}
+
+SoLoud::handle AudioEngine::startVoice(SoundId sound, float volume, float pan, float gain) {
+    SoundEntry& entry = *sounds[sound];
+    VoiceAdmission admission = voicePool.evaluate(entry.group, volume);
+    if (admission.decision == VoiceDecision::Reject) {
+        // Finished voices may still be counted; reclaim them and retry once.
+        pruneVoices();
+        admission = voicePool.evaluate(entry.group, volume);
+    }
+    voicePool.recordAdmission(admission);
+    if (!admission.accepted()) {
+        return 0;
+    }
+
+    // Decode (and possibly evict other clips) only for voices that will play.
+    SoLoud::AudioSource* source = acquireSource(sound);
+    if (!source) {
+        return 0;
+    }
+
+    if (admission.decision == VoiceDecision::Steal) {
+        soloud.stop(admission.victim);
+        voicePool.onVoiceStopped(admission.victim);
+        spatialVoices.remove(admission.victim);
+    }
+
+    // Admission uses the unattenuated volume; the voice starts at its attenuated one.
+    const float startVolume = admission.volume * gain;
+    SoLoud::handle voice = soloud.play(*source, startVolume, pan);
+    voicePool.onVoiceStarted(voice, entry.group, startVolume);
+    return voice;
+}
+
+void AudioEngine::stopSound(SoLoud::handle voice) {
+    soloud.stop(voice);
+    voicePool.onVoiceStopped(voice);
+    spatialVoices.remove(voice);
+}
+
+void AudioEngine::setListener(const Camera& camera) {
+    listenerPosition = camera.getPosition();
+}
+
+SoLoud::handle AudioEngine::playSoundAt(SoundId sound, const Vec2& position, float volume) {
+    if (sound >= sounds.size()) {
+        Log::warn("Invalid sound id: {}", sound);
+        return 0;
+    }
+
+    float gain = 0.0f;
+    float pan = 0.0f;
+    computeSpatialParams(listenerPosition, spatialSettings, &position, 1, &gain, &pan);
+    if (gain * volume < spatialSettings.minAudibleGain) {
+        gain = 0.0f;  // Starts virtual
+    }
+
+    // Admit on the unattenuated volume: an emitter that starts out of range
+    // is still tracked (virtualized) and becomes audible as the listener
+    // approaches.
+    SoLoud::handle voice = startVoice(sound, volume, pan, gain);
+    if (voice != 0) {
+        // Inaudible voices are neither ticked nor decoded; SoLoud only
+        // advances their play position.
+        soloud.setInaudibleBehavior(voice, false, false);
+        const float groupVolume = voicePool.getGroupConfig(sounds[sound]->group).volume;
+        spatialVoices.add(voice, position, volume * groupVolume);
     }
+    return voice;
+}
+
+void AudioEngine::setVoicePosition(SoLoud::handle voice, const Vec2& position) {
+    spatialVoices.setPosition(voice, position);
+}
+
+VoiceId AudioEngine::postPlayAt(SoundId sound, const Vec2& position, float volume) {
+    const VoiceId voice = allocateVoiceId();
+    AudioCommand command;
+    command.type = AudioCommandType::PlayAt;
+    command.sound = sound;
+    command.voice = voice;
+    command.volume = volume;
+    command.x = position.x;
+    command.y = position.y;
+    return commands.push(command) ? voice : kInvalidVoiceId;
+}
+
+bool AudioEngine::postSetPosition(VoiceId voice, const Vec2& position) {
+    AudioCommand command;
+    command.type = AudioCommandType::SetPosition;
+    command.voice = voice;
+    command.x = position.x;
+    command.y = position.y;
+    return commands.push(command);
+}
+
+void AudioEngine::updateSpatialVoices() {
+    if (!initialized || spatialVoices.size() == 0) return;
+    spatialVoices.update(listenerPosition, spatialSettings,
+        [this](SoLoud::handle voice, float volume, float pan, bool) {
+            soloud.setVolume(voice, volume);
+            soloud.setPan(voice, pan);
+            voicePool.setVoiceVolume(voice, volume);
+        });
+}
+
+VoiceId AudioEngine::postPlay(SoundId sound, float volume, float pan) {
+    const VoiceId voice = allocateVoiceId();
+    AudioCommand command;
+    command.type = AudioCommandType::Play;
+    command.sound = sound;
+    command.voice = voice;
+    command.volume = volume;
+    command.pan = pan;
+    return commands.push(command) ? voice : kInvalidVoiceId;
+}
+
+VoiceId AudioEngine::allocateVoiceId() {
+    VoiceId voice = nextVoiceId.fetch_add(1, std::memory_order_relaxed);
+    if (voice == kInvalidVoiceId) {
+        voice = nextVoiceId.fetch_add(1, std::memory_order_relaxed);  // Skip 0 on wrap-around
+    }
+    return voice;
+}
+
+bool AudioEngine::postStop(VoiceId voice) {
+    AudioCommand command;
+    command.type = AudioCommandType::Stop;
+    command.voice = voice;
+    return commands.push(command);
+}
+
+bool AudioEngine::postSetVolume(VoiceId voice, float volume) {
+    AudioCommand command;
+    command.type = AudioCommandType::SetVolume;
+    command.voice = voice;
+    command.volume = volume;
+    return commands.push(command);
+}
+
+bool AudioEngine::postSetPan(VoiceId voice, float pan) {
+    AudioCommand command;
+    command.type = AudioCommandType::SetPan;
+    command.voice = voice;
+    command.pan = pan;
+    return commands.push(command);
+}
+
+void AudioEngine::applyCommand(const AudioCommand& command) {
+    if (command.type == AudioCommandType::Play || command.type == AudioCommandType::PlayAt) {
+        SoLoud::handle handle = command.type == AudioCommandType::PlayAt
+            ? playSoundAt(command.sound, Vec2(command.x, command.y), command.volume)
+            : playSound(command.sound, command.volume, command.pan);
+        if (handle != 0) {
+            voiceHandles[command.voice] = handle;
+        }
+        return;
+    }
+
+    // Voices that were culled, stolen or already finished are silently ignored.
+    auto it = voiceHandles.find(command.voice);
+    if (it == voiceHandles.end()) return;
+
+    switch (command.type) {
+        case AudioCommandType::Stop:
+            stopSound(it->second);
+            voiceHandles.erase(it);
+            break;
+        case AudioCommandType::SetVolume: {
+            // Keep the group volume applied at admission
+            const uint32_t group = voicePool.getVoiceGroup(it->second);
+            const float volume = command.volume * voicePool.getGroupConfig(group).volume;
+            if (spatialVoices.setVolume(it->second, volume)) {
+                break;  // Applied with attenuation on the next spatial pass
+            }
+            soloud.setVolume(it->second, volume);
+            voicePool.setVoiceVolume(it->second, volume);
+            break;
+        }
+        case AudioCommandType::SetPan:
+            soloud.setPan(it->second, command.pan);
+            break;
+        case AudioCommandType::SetPosition:
+            spatialVoices.setPosition(it->second, Vec2(command.x, command.y));
+            break;
+        case AudioCommandType::Play:
+        case AudioCommandType::PlayAt:
+        default:
+            break;
+    }
+}
+
+void AudioEngine::setSoundGroup(const std::string& group, const SoundGroupConfig& config) {
+    auto it = groupIds.find(group);
+    if (it != groupIds.end()) {
+        voicePool.setGroupConfig(it->second, config);
+    } else {
+        groupIds[group] = voicePool.addGroup(config);
+    }
+}
+
+void AudioEngine::assignSoundToGroup(const std::string& sound, const std::string& group) {
+    SoundId id = getSoundId(sound);
+    if (id == kInvalidSoundId) {
+        Log::warn("Sound not found: {}", sound);
+        return;
+    }
+    auto groupIt = groupIds.find(group);
+    if (groupIt == groupIds.end()) {
+        Log::warn("Sound group not found: {}", group);
+        return;
+    }
+    sounds[id]->group = groupIt->second;
+}
+
+void AudioEngine::setMaxVoices(uint32_t maxVoices) {
+    voicePool.setMaxVoices(maxVoices);
+    if (initialized) {
+        soloud.setMaxActiveVoiceCount(std::clamp(maxVoices, 1u, kMaxMixedVoices));
+    }
+}
+
+void AudioEngine::pruneVoices() {
+    if (!initialized) return;
+    voicePool.prune([this](SoLoud::handle voice) {
+        return soloud.isValidVoiceHandle(voice) != 0;
+    });
+    std::erase_if(voiceHandles, [this](const auto& entry) {
+        return soloud.isValidVoiceHandle(entry.second) == 0;
+    });
+    spatialVoices.prune([this](SoLoud::handle voice) {
+        return soloud.isValidVoiceHandle(voice) != 0;
+    });
 }
 
 void AudioEngine::loadMusic(const std::string& name, const std::string& path) {
-    SoLoud::WavStream stream;
-    SoLoud::result result = stream.load(path.c_str());
-    
+    // The previous stream (if any) keeps playing until the new one is ready.
+    MusicTrack& track = music[name];
+    if (track.prefetch.valid()) {
+        // Replacing a running future would block in its destructor until the
+        // read finishes; queue the new path and start it from update().
+        track.queuedPath = path == track.prefetchPath ? std::string() : path;
+        return;
+    }
+    track.prefetchPath = path;
+    track.prefetch = std::async(std::launch::async, &AudioEngine::readMusic, path);
+}
+
+std::unique_ptr<SoLoud::WavStream> AudioEngine::readMusic(const std::string& path) {
+    // Runs on a worker thread. loadToMem pulls the whole encoded file into
+    // memory, so the mixer decodes without blocking on file I/O.
+    MemoryTagScope memoryTag(MemoryTag::Audio);
+    auto stream = std::make_unique<SoLoud::WavStream>();
+    SoLoud::result result = stream->loadToMem(path.c_str());
     if (result != SoLoud::SO_NO_ERROR) {
         Log::error("Failed to load music: {} (error: {})", path, result);
+        return nullptr;
+    }
+    return stream;
+}
+
+bool AudioEngine::isMusicReady(const std::string& name) const {
+    auto it = music.find(name);
+    return it != music.end() && it->second.stream != nullptr;
+}
+
+void AudioEngine::setMusicLoopStart(const std::string& name, double loopStart) {
+    auto it = music.find(name);
+    if (it == music.end()) {
+        Log::warn("Music not found: {}", name);
         return;
     }
-    
-    music[name] = std::move(stream);
-    Log::info("Music loaded: {}", name);
+    it->second.loopStart = loopStart;
+    if (it->second.stream) {
+        it->second.stream->setLoopPoint(loopStart);
+    }
+}
+
+void AudioEngine::pollMusic() {
+    for (auto& [name, track] : music) {
+        if (!track.prefetch.valid() ||
+            track.prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+        std::unique_ptr<SoLoud::WavStream> stream = track.prefetch.get();
+        if (!track.queuedPath.empty()) {
+            // Superseded while it was reading
+            track.prefetchPath = std::exchange(track.queuedPath, std::string());
+            track.prefetch = std::async(std::launch::async, &AudioEngine::readMusic, track.prefetchPath);
+            continue;
+        }
+        if (!stream) continue;
+        if (track.stream) {
+            soloud.stopAudioSource(*track.stream);
+        }
+        stream->setLoopPoint(track.loopStart);
+        track.stream = std::move(stream);
+        Log::info("Music loaded: {}", name);
+    }
+
+    if (currentMusicHandle != 0 && !soloud.isValidVoiceHandle(currentMusicHandle)) {
+        currentMusicHandle = 0;
+    }
+    if (fadingMusicHandle != 0 && !soloud.isValidVoiceHandle(fadingMusicHandle)) {
+        fadingMusicHandle = 0;
+    }
+
+    if (pendingMusic.name.empty()) return;
+    auto it = music.find(pendingMusic.name);
+    if (it == music.end() || (!it->second.stream && !it->second.prefetch.valid())) {
+        Log::warn("Music failed to load, not playing: {}", pendingMusic.name);
+        pendingMusic = PendingMusic{};
+    } else if (it->second.stream) {
+        PendingMusic request = std::move(pendingMusic);
+        pendingMusic = PendingMusic{};
+        startMusic(it->second, request);
+    }
 }
 
-void AudioEngine::playMusic(const std::string& name, float volume, bool loop) {
+void AudioEngine::playMusic(const std::string& name, float volume, bool loop, float crossfadeSeconds) {
     auto it = music.find(name);
-    if (it != music.end()) {
-        stopMusic();  // Stop current music first
-        it->second.setLooping(loop);
-        currentMusicHandle = soloud.play(it->second, volume);
-        Log::info("Playing music: {}", name);
-    } else {
+    if (it == music.end()) {
         Log::warn("Music not found: {}", name);
+        return;
+    }
+
+    PendingMusic request{name, volume, loop, crossfadeSeconds};
+    if (it->second.stream) {
+        pendingMusic = PendingMusic{};
+        startMusic(it->second, request);
+    } else {
+        pendingMusic = std::move(request);  // Started by update() once prefetched
+    }
+}
+
+void AudioEngine::startMusic(MusicTrack& track, const PendingMusic& request) {
+    const float fade = std::max(request.crossfade, 0.0f);
+    track.stream->setLooping(request.loop);
+
+    // The new voice starts paused with its fade already set, and is released
+    // right after the old voice's fade-out is issued. SoLoud faders advance
+    // with each voice's own play time, so both ramps run in lockstep.
+    SoLoud::handle next = soloud.play(*track.stream, fade > 0.0f ? 0.0f : request.volume, 0.0f, true);
+    soloud.setProtectVoice(next, true);
+    if (fade > 0.0f) {
+        soloud.fadeVolume(next, request.volume, fade);
+    }
+
+    if (fadingMusicHandle != 0) {
+        soloud.stop(fadingMusicHandle);
+        fadingMusicHandle = 0;
     }
+    if (currentMusicHandle != 0) {
+        if (fade > 0.0f) {
+            soloud.fadeVolume(currentMusicHandle, 0.0f, fade);
+            soloud.scheduleStop(currentMusicHandle, fade);
+            fadingMusicHandle = currentMusicHandle;
+        } else {
+            soloud.stop(currentMusicHandle);
+        }
+    }
+
+    soloud.setPause(next, false);
+    currentMusicHandle = next;
+    Log::info("Playing music: {}", request.name);
 }
 
-void AudioEngine::stopMusic() {
-    if (currentMusicHandle != -1) {
+void AudioEngine::stopMusic(float fadeSeconds) {
+    pendingMusic = PendingMusic{};
+    if (fadingMusicHandle != 0) {
+        soloud.stop(fadingMusicHandle);
+        fadingMusicHandle = 0;
+    }
+    if (currentMusicHandle == 0) return;
+
+    if (fadeSeconds > 0.0f) {
+        soloud.fadeVolume(currentMusicHandle, 0.0f, fadeSeconds);
+        soloud.scheduleStop(currentMusicHandle, fadeSeconds);
+        fadingMusicHandle = currentMusicHandle;
+    } else {
         soloud.stop(currentMusicHandle);
-        currentMusicHandle = -1;
     }
+    currentMusicHandle = 0;
 }
 
 void AudioEngine::pauseMusic() {
-    if (currentMusicHandle != -1) {
+    if (currentMusicHandle != 0) {
         soloud.setPause(currentMusicHandle, true);
     }
+    if (fadingMusicHandle != 0) {
+        soloud.setPause(fadingMusicHandle, true);
+    }
 }
 
 void AudioEngine::resumeMusic() {
-    if (currentMusicHandle != -1) {
+    if (currentMusicHandle != 0) {
         soloud.setPause(currentMusicHandle, false);
     }
+    if (fadingMusicHandle != 0) {
+        soloud.setPause(fadingMusicHandle, false);
+    }
 }
 
 void AudioEngine::setMasterVolume(float volume) {
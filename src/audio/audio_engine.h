@@ -1,28 +1,123 @@
 #pragma once
+#include "audio/audio_command_queue.h"
+#include "audio/clip_cache.h"
+#include "audio/sound_bank.h"
+#include "audio/spatial_audio.h"
+#include "audio/voice_pool.h"
 #include <soloud.h>
 #include <soloud_wav.h>
 #include <soloud_wavstream.h>
+#include <atomic>
+#include <future>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Engine {
 
+class Camera;
+
+enum class AudioBackend {
+    Default,  // Platform audio device
+    Null      // No device; mix into memory with mixOffline()
+};
+
+struct AudioConfig {
+    AudioBackend backend = AudioBackend::Default;
+    uint32_t sampleRate = 0;     // 0 = backend default (44100 for Null)
+    uint32_t bufferSize = 0;     // Frames per mix, 0 = backend default
+    uint32_t channels = 2;
+    uint32_t maxVoices = 32;
+    bool fallbackToNull = true;  // Use the null backend if no device opens (headless CI)
+};
+
 class AudioEngine {
 public:
     AudioEngine() = default;
     ~AudioEngine() { shutdown(); }
     
-    void init();
+    bool init(const AudioConfig& config = AudioConfig{});
     void shutdown();
+    bool isInitialized() const { return initialized; }
+    
+    // Offline mixing (Null backend only): renders `frames` interleaved
+    // float frames into `buffer` as fast as possible.
+    uint32_t mixOffline(float* buffer, uint32_t frames);
+    bool isOffline() const { return backend == AudioBackend::Null; }
+    uint32_t getSampleRate() const { return sampleRate; }
+    uint32_t getChannels() const { return channels; }
+
+    // Per-frame audio step: applies queued commands, reclaims finished voices
+    void update();
     
     // Sound effects (loaded into memory, fast playback)
-    void loadSound(const std::string& name, const std::string& path);
-    void playSound(const std::string& name, float volume = 1.0f);
+    // Load and look up sounds on the owning thread; the returned ids may be
+    // handed to any thread.
+    SoundId loadSound(const std::string& name, const std::string& path);
+    SoundId getSoundId(const std::string& name) const;
+    SoLoud::handle playSound(const std::string& name, float volume = 1.0f);  // 0 if not played
+    SoLoud::handle playSound(SoundId sound, float volume = 1.0f, float pan = 0.0f);
+    void stopSound(SoLoud::handle voice);
+    
+    // Thread-safe command submission, applied in one batch by update().
+    // Return false / kInvalidVoiceId when the command queue is full.
+    VoiceId postPlay(SoundId sound, float volume = 1.0f, float pan = 0.0f);
+    bool postStop(VoiceId voice);
+    bool postSetVolume(VoiceId voice, float volume);
+    bool postSetPan(VoiceId voice, float pan);
+    uint64_t getDroppedCommandCount() const { return commands.getDroppedCount(); }
+    
+    // Positional audio: attenuation and pan relative to a listener (usually
+    // the camera), recomputed for all positional voices in update(). Voices
+    // out of range are virtualized: kept alive but not mixed.
+    void setListener(const Camera& camera);
+    void setListenerPosition(const Vec2& position) { listenerPosition = position; }
+    Vec2 getListenerPosition() const { return listenerPosition; }
+    void setSpatialSettings(const SpatialSettings& settings) { spatialSettings = settings; }
+    const SpatialSettings& getSpatialSettings() const { return spatialSettings; }
+    SoLoud::handle playSoundAt(SoundId sound, const Vec2& position, float volume = 1.0f);
+    void setVoicePosition(SoLoud::handle voice, const Vec2& position);
+    VoiceId postPlayAt(SoundId sound, const Vec2& position, float volume = 1.0f);
+    bool postSetPosition(VoiceId voice, const Vec2& position);
+    uint32_t getVirtualVoiceCount() const { return spatialVoices.getVirtualCount(); }
+    
+    // Sound banks (many clips packed in one file, see sound_bank.h).
+    // Async loads read and decode on a worker; clips register during update().
+    bool loadSoundBank(const std::string& path);
+    void loadSoundBankAsync(const std::string& path);
+    bool isLoadingSoundBanks() const { return !pendingBanks.empty(); }
     
-    // Music (streamed from disk, lower memory)
+    // Decoded PCM budget for bank clips (least recently played are evicted
+    // and decoded again on demand)
+    void setSoundMemoryBudget(size_t bytes);
+    size_t getSoundMemoryBudget() const { return clipCache.getBudget(); }
+    size_t getSoundMemoryUsed() const { return clipCache.getUsedBytes(); }
+    uint64_t getSoundEvictionCount() const { return clipCache.getEvictionCount(); }
+    
+    // Sound groups (instance limits, priority, group volume)
+    void setSoundGroup(const std::string& group, const SoundGroupConfig& config);
+    void assignSoundToGroup(const std::string& sound, const std::string& group);
+    
+    // Global voice budget and inaudible-voice culling
+    void setMaxVoices(uint32_t maxVoices);
+    uint32_t getMaxVoices() const { return voicePool.getMaxVoices(); }
+    void setMinAudibleVolume(float volume) { voicePool.setMinAudibleVolume(volume); }
+    const VoiceStats& getVoiceStats() const { return voicePool.getStats(); }
+    void resetVoiceStats() { voicePool.resetStats(); }
+    
+    // Music (streamed, decoded while mixing). loadMusic prefetches the
+    // encoded track into memory on a worker, so starting it never touches
+    // the disk. playMusic crossfades from the current track; a track still
+    // prefetching starts from update() once it is ready.
     void loadMusic(const std::string& name, const std::string& path);
-    void playMusic(const std::string& name, float volume = 1.0f, bool loop = true);
-    void stopMusic();
+    bool isMusicReady(const std::string& name) const;
+    // Intro/loop region: the first pass plays from the start, later passes
+    // wrap back to loopStart (seconds) inside the mixer.
+    void setMusicLoopStart(const std::string& name, double loopStart);
+    void playMusic(const std::string& name, float volume = 1.0f, bool loop = true,
+                   float crossfadeSeconds = 0.0f);
+    void stopMusic(float fadeSeconds = 0.0f);
     void pauseMusic();
     void resumeMusic();
     
@@ -31,13 +126,80 @@ public:
     float getMasterVolume() const;
     
     // Check if playing
-    bool isMusicPlaying() const { return currentMusicHandle != -1; }
+    bool isMusicPlaying() const { return currentMusicHandle != 0; }
     
 private:
+    struct SoundEntry {
+        std::unique_ptr<SoLoud::Wav> wav;           // Decoded PCM; null while evicted or streamed
+        std::unique_ptr<SoLoud::WavStream> stream;  // Compressed clip, decoded while mixing
+        std::shared_ptr<const SoundBank> bank;      // Encoded source for bank clips
+        const SoundBankClip* clip = nullptr;
+        uint32_t group = VoicePool::kDefaultGroup;
+    };
+
+    struct LoadedBank {
+        std::shared_ptr<const SoundBank> bank;
+        std::vector<std::unique_ptr<SoundEntry>> entries;  // Parallel to bank->getClips()
+    };
+
+    struct MusicTrack {
+        std::unique_ptr<SoLoud::WavStream> stream;  // Null until prefetched
+        std::future<std::unique_ptr<SoLoud::WavStream>> prefetch;
+        std::string prefetchPath;  // File being read by `prefetch`
+        std::string queuedPath;    // Requested while a prefetch was running
+        double loopStart = 0.0;
+    };
+
+    struct PendingMusic {
+        std::string name;  // Empty when nothing is waiting
+        float volume = 1.0f;
+        bool loop = true;
+        float crossfade = 0.0f;
+    };
+
+    struct PendingBank {
+        std::string path;
+        std::future<std::unique_ptr<LoadedBank>> result;
+    };
+
     SoLoud::Soloud soloud;
-    std::unordered_map<std::string, SoLoud::Wav> sounds;
-    std::unordered_map<std::string, SoLoud::WavStream> music;
-    int currentMusicHandle = -1;
+    std::vector<std::unique_ptr<SoundEntry>> sounds;  // Indexed by SoundId
+    std::unordered_map<std::string, SoundId> soundIds;
+    std::unordered_map<std::string, MusicTrack> music;
+    std::unordered_map<std::string, uint32_t> groupIds;
+    VoicePool voicePool;
+    ClipCache clipCache;
+    SpatialVoiceSet spatialVoices;
+    SpatialSettings spatialSettings;
+    Vec2 listenerPosition{0.0f, 0.0f};
+    std::vector<PendingBank> pendingBanks;
+    PendingMusic pendingMusic;
+    SoLoud::handle currentMusicHandle = 0;
+    SoLoud::handle fadingMusicHandle = 0;  // Previous track while a crossfade runs
+    bool initialized = false;
+    AudioBackend backend = AudioBackend::Default;
+    uint32_t sampleRate = 0;
+    uint32_t channels = 2;
+
+    // Cross-thread command path
+    AudioCommandQueue commands;
+    std::atomic<VoiceId> nextVoiceId{1};
+    std::unordered_map<VoiceId, SoLoud::handle> voiceHandles;
+
+    SoundId registerSound(const std::string& name, std::unique_ptr<SoundEntry> entry);
+    SoLoud::AudioSource* acquireSource(SoundId sound);
+    SoLoud::handle startVoice(SoundId sound, float volume, float pan, float gain);
+    void evictDecodedClips(SoundId keep);
+    void registerBank(const std::string& path, std::unique_ptr<LoadedBank> loaded);
+    void pollPendingBanks();
+    VoiceId allocateVoiceId();
+    void applyCommand(const AudioCommand& command);
+    void updateSpatialVoices();
+    void pruneVoices();
+    void pollMusic();
+    void startMusic(MusicTrack& track, const PendingMusic& request);
+    static std::unique_ptr<LoadedBank> readBank(const std::string& path);
+    static std::unique_ptr<SoLoud::WavStream> readMusic(const std::string& path);
 };
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -0,0 +1,26 @@
+#include "clip_cache.h"
+
+namespace Engine {
+
+void ClipCache::insert(Key key, size_t bytes) {
+    erase(key);
+    order.push_front(key);
+    entries[key] = Entry{order.begin(), bytes};
+    usedBytes += bytes;
+}
+
+void ClipCache::touch(Key key) {
+    auto it = entries.find(key);
+    if (it == entries.end()) return;
+    order.splice(order.begin(), order, it->second.position);
+}
+
+void ClipCache::erase(Key key) {
+    auto it = entries.find(key);
+    if (it == entries.end()) return;
+    usedBytes -= it->second.bytes;
+    order.erase(it->second.position);
+    entries.erase(it);
+}
+
+} // namespace Engine
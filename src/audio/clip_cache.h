@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+// Byte-budgeted LRU bookkeeping for decoded sound clips. Tracks sizes and
+// recency only; the owner frees whatever evict() reports.
+class ClipCache {
+public:
+    using Key = uint32_t;
+
+    explicit ClipCache(size_t budgetBytes = 64 * 1024 * 1024) : budget(budgetBytes) {}
+
+    void setBudget(size_t bytes) { budget = bytes; }
+    size_t getBudget() const { return budget; }
+    size_t getUsedBytes() const { return usedBytes; }
+    size_t getEntryCount() const { return entries.size(); }
+    uint64_t getEvictionCount() const { return evictions; }
+
+    void insert(Key key, size_t bytes);  // Inserted as most recently used
+    void touch(Key key);
+    void erase(Key key);
+    bool contains(Key key) const { return entries.count(key) != 0; }
+
+    // Evict least recently used entries until within budget.
+    // canEvict(key) lets the owner pin entries that are still in use.
+    template <typename CanEvictFn>
+    std::vector<Key> evict(CanEvictFn&& canEvict);
+
+private:
+    struct Entry {
+        std::list<Key>::iterator position;
+        size_t bytes;
+    };
+
+    std::list<Key> order;  // Front = most recently used
+    std::unordered_map<Key, Entry> entries;
+    size_t budget;
+    size_t usedBytes = 0;
+    uint64_t evictions = 0;
+};
+
+template <typename CanEvictFn>
+std::vector<ClipCache::Key> ClipCache::evict(CanEvictFn&& canEvict) {
+    std::vector<Key> evicted;
+    auto it = order.end();
+    while (usedBytes > budget && it != order.begin()) {
+        --it;
+        Key key = *it;
+        if (!canEvict(key)) continue;
+
+        usedBytes -= entries[key].bytes;
+        entries.erase(key);
+        it = order.erase(it);
+        evicted.push_back(key);
+        ++evictions;
+    }
+    return evicted;
+}
+
+} // namespace Engine
@@ -0,0 +1,108 @@
+#include "sound_bank.h"
+#include "platform/file_system.h"
+#include "platform/logging.h"
+#include <cstring>
+
+namespace Engine {
+
+namespace {
+
+// Bounds-checked little-endian reader over the bank bytes
+class ByteReader {
+public:
+    explicit ByteReader(const std::vector<uint8_t>& bytes) : bytes(bytes) {}
+
+    bool read(void* out, size_t count) {
+        if (count > bytes.size() - pos) return false;
+        std::memcpy(out, bytes.data() + pos, count);
+        pos += count;
+        return true;
+    }
+
+    template <typename T>
+    bool readValue(T& out) {
+        uint8_t raw[sizeof(T)];
+        if (!read(raw, sizeof(T))) return false;
+        T value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            value |= static_cast<T>(static_cast<T>(raw[i]) << (8 * i));
+        }
+        out = value;
+        return true;
+    }
+
+private:
+    const std::vector<uint8_t>& bytes;
+    size_t pos = 0;
+};
+
+} // namespace
+
+bool SoundBank::loadFromFile(const std::string& path) {
+    auto bytes = FileSystem::loadBinaryFile(path);
+    if (!bytes) {
+        Log::error("Failed to load sound bank: {}", path);
+        return false;
+    }
+    if (!loadFromMemory(std::move(*bytes))) {
+        Log::error("Invalid sound bank: {}", path);
+        return false;
+    }
+    Log::info("Sound bank loaded: {} ({} clips, {} bytes)", path, clips.size(), data.size());
+    return true;
+}
+
+bool SoundBank::loadFromMemory(std::vector<uint8_t> bytes) {
+    data.clear();
+    clips.clear();
+
+    ByteReader reader(bytes);
+    char magic[4];
+    uint32_t version = 0;
+    uint32_t count = 0;
+    if (!reader.read(magic, sizeof(magic)) || std::memcmp(magic, "SBNK", 4) != 0) {
+        Log::error("Sound bank: bad magic");
+        return false;
+    }
+    if (!reader.readValue(version) || version != kVersion) {
+        Log::error("Sound bank: unsupported version {}", version);
+        return false;
+    }
+    if (!reader.readValue(count)) {
+        return false;
+    }
+
+    std::vector<SoundBankClip> parsed;
+    parsed.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        SoundBankClip clip;
+        uint16_t nameLength = 0;
+        if (!reader.readValue(nameLength)) return false;
+        clip.name.resize(nameLength);
+        if (!reader.read(clip.name.data(), nameLength) ||
+            !reader.readValue(clip.flags) ||
+            !reader.readValue(clip.offset) ||
+            !reader.readValue(clip.size)) {
+            Log::error("Sound bank: truncated clip table");
+            return false;
+        }
+        if (static_cast<uint64_t>(clip.offset) + clip.size > bytes.size()) {
+            Log::error("Sound bank: clip '{}' out of range", clip.name);
+            return false;
+        }
+        parsed.push_back(std::move(clip));
+    }
+
+    data = std::move(bytes);
+    clips = std::move(parsed);
+    return true;
+}
+
+const SoundBankClip* SoundBank::findClip(const std::string& name) const {
+    for (const auto& clip : clips) {
+        if (clip.name == name) return &clip;
+    }
+    return nullptr;
+}
+
+} // namespace Engine
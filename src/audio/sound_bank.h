@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// Sound bank file layout (little-endian, written by tools/pack_sound_bank.py):
+//   char[4]  magic "SBNK"
+//   uint32   version
+//   uint32   clip count
+//   per clip: uint16 name length, name bytes, uint8 flags, uint32 offset, uint32 size
+//   clip payloads (encoded WAV/OGG/... files), offsets relative to file start
+enum SoundClipFlags : uint8_t {
+    SoundClipCompressed = 1 << 0,  // Keep encoded in memory, decode while playing
+    SoundClipPreload = 1 << 1      // Decode to PCM as soon as the bank loads
+};
+
+struct SoundBankClip {
+    std::string name;
+    uint8_t flags = 0;
+    uint32_t offset = 0;
+    uint32_t size = 0;
+
+    bool isCompressed() const { return (flags & SoundClipCompressed) != 0; }
+    bool isPreload() const { return (flags & SoundClipPreload) != 0; }
+};
+
+// Immutable packed collection of encoded clips. Owns the file bytes so
+// clips can be decoded (or streamed) straight from memory.
+class SoundBank {
+public:
+    static constexpr uint32_t kVersion = 1;
+
+    SoundBank() = default;
+
+    bool loadFromFile(const std::string& path);
+    bool loadFromMemory(std::vector<uint8_t> bytes);
+
+    const std::vector<SoundBankClip>& getClips() const { return clips; }
+    const SoundBankClip* findClip(const std::string& name) const;
+    const uint8_t* getClipData(const SoundBankClip& clip) const { return data.data() + clip.offset; }
+
+    size_t getClipCount() const { return clips.size(); }
+    size_t getByteSize() const { return data.size(); }
+    bool isLoaded() const { return !data.empty(); }
+
+private:
+    std::vector<uint8_t> data;
+    std::vector<SoundBankClip> clips;
+};
+
+} // namespace Engine
@@ -0,0 +1,99 @@
+#include "spatial_audio.h"
+#include <algorithm>
+
+namespace Engine {
+
+void computeSpatialParams(const Vec2& listener, const SpatialSettings& settings,
+                          const Vec2* positions, size_t count,
+                          float* gains, float* pans) {
+    const float range = std::max(settings.maxDistance - settings.minDistance, 0.0001f);
+    const float invRange = 1.0f / range;
+    const float invPanDistance = 1.0f / std::max(settings.panDistance, 0.0001f);
+    const bool linear = settings.rolloff == 1.0f;
+
+    for (size_t i = 0; i < count; ++i) {
+        const float dx = positions[i].x - listener.x;
+        const float dy = positions[i].y - listener.y;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+        const float t = std::clamp((settings.maxDistance - distance) * invRange, 0.0f, 1.0f);
+        gains[i] = t;
+        pans[i] = std::clamp(dx * invPanDistance, -1.0f, 1.0f);
+    }
+
+    if (!linear) {
+        for (size_t i = 0; i < count; ++i) {
+            gains[i] = std::pow(gains[i], settings.rolloff);
+        }
+    }
+}
+
+void SpatialVoiceSet::add(VoiceHandle handle, const Vec2& position, float volume) {
+    if (indexOf(handle) != npos) {
+        remove(handle);
+    }
+    handles.push_back(handle);
+    positions.push_back(position);
+    volumes.push_back(volume);
+    // Negative applied values force the first update() to push parameters.
+    appliedVolumes.push_back(-1.0f);
+    appliedPans.push_back(-2.0f);
+    virtualized.push_back(0);
+}
+
+void SpatialVoiceSet::remove(VoiceHandle handle) {
+    size_t index = indexOf(handle);
+    if (index != npos) {
+        removeAt(index);
+    }
+}
+
+bool SpatialVoiceSet::setPosition(VoiceHandle handle, const Vec2& position) {
+    size_t index = indexOf(handle);
+    if (index == npos) return false;
+    positions[index] = position;
+    return true;
+}
+
+bool SpatialVoiceSet::setVolume(VoiceHandle handle, float volume) {
+    size_t index = indexOf(handle);
+    if (index == npos) return false;
+    volumes[index] = volume;
+    return true;
+}
+
+void SpatialVoiceSet::clear() {
+    handles.clear();
+    positions.clear();
+    volumes.clear();
+    gains.clear();
+    pans.clear();
+    appliedVolumes.clear();
+    appliedPans.clear();
+    virtualized.clear();
+    virtualCount = 0;
+}
+
+size_t SpatialVoiceSet::indexOf(VoiceHandle handle) const {
+    auto it = std::find(handles.begin(), handles.end(), handle);
+    return it != handles.end() ? static_cast<size_t>(it - handles.begin()) : npos;
+}
+
+void SpatialVoiceSet::removeAt(size_t index) {
+    // Swap-and-pop keeps the arrays dense.
+    const size_t last = handles.size() - 1;
+    if (virtualized[index]) --virtualCount;
+    handles[index] = handles[last];
+    positions[index] = positions[last];
+    volumes[index] = volumes[last];
+    appliedVolumes[index] = appliedVolumes[last];
+    appliedPans[index] = appliedPans[last];
+    virtualized[index] = virtualized[last];
+    handles.pop_back();
+    positions.pop_back();
+    volumes.pop_back();
+    appliedVolumes.pop_back();
+    appliedPans.pop_back();
+    virtualized.pop_back();
+}
+
+} // namespace Engine
@@ -0,0 +1,101 @@
+#pragma once
+#include "math/vector.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Distance model for positional sounds (world units)
+struct SpatialSettings {
+    float minDistance = 100.0f;   // Full volume inside this radius
+    float maxDistance = 1200.0f;  // Silent beyond this radius
+    float rolloff = 1.0f;         // Curve exponent between min and max (1 = linear)
+    float panDistance = 600.0f;   // Horizontal offset that pans fully left/right
+    float minAudibleGain = 0.01f; // Below this a voice is virtualized
+};
+
+// Batched attenuation/pan over contiguous arrays. Branch-free so the
+// compiler can vectorize it.
+void computeSpatialParams(const Vec2& listener, const SpatialSettings& settings,
+                          const Vec2* positions, size_t count,
+                          float* gains, float* pans);
+
+// Positional voices stored as parallel arrays. update() recomputes every
+// voice in one pass and reports only the ones whose mix parameters changed.
+class SpatialVoiceSet {
+public:
+    using VoiceHandle = unsigned int;
+
+    void add(VoiceHandle handle, const Vec2& position, float volume);
+    void remove(VoiceHandle handle);
+    bool setPosition(VoiceHandle handle, const Vec2& position);
+    bool setVolume(VoiceHandle handle, float volume);
+    bool contains(VoiceHandle handle) const { return indexOf(handle) != npos; }
+    void clear();
+
+    // apply(handle, volume, pan, isVirtual) is called for changed voices only.
+    template <typename ApplyFn>
+    void update(const Vec2& listener, const SpatialSettings& settings, ApplyFn&& apply);
+
+    // Drop voices the mixer has finished with (isAlive(handle) -> bool)
+    template <typename IsAliveFn>
+    void prune(IsAliveFn&& isAlive);
+
+    size_t size() const { return handles.size(); }
+    uint32_t getVirtualCount() const { return virtualCount; }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr float kChangeEpsilon = 0.001f;
+
+    std::vector<VoiceHandle> handles;
+    std::vector<Vec2> positions;
+    std::vector<float> volumes;      // Base (unattenuated) volume
+    std::vector<float> gains;        // Scratch output of the batch pass
+    std::vector<float> pans;
+    std::vector<float> appliedVolumes;
+    std::vector<float> appliedPans;
+    std::vector<uint8_t> virtualized;
+    uint32_t virtualCount = 0;
+
+    size_t indexOf(VoiceHandle handle) const;
+    void removeAt(size_t index);
+};
+
+template <typename ApplyFn>
+void SpatialVoiceSet::update(const Vec2& listener, const SpatialSettings& settings, ApplyFn&& apply) {
+    const size_t count = handles.size();
+    gains.resize(count);
+    pans.resize(count);
+    computeSpatialParams(listener, settings, positions.data(), count, gains.data(), pans.data());
+
+    virtualCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const bool isVirtual = gains[i] * volumes[i] < settings.minAudibleGain;
+        const float volume = isVirtual ? 0.0f : gains[i] * volumes[i];
+        virtualCount += isVirtual ? 1 : 0;
+
+        const bool changed = (isVirtual != (virtualized[i] != 0)) ||
+            std::abs(volume - appliedVolumes[i]) > kChangeEpsilon ||
+            std::abs(pans[i] - appliedPans[i]) > kChangeEpsilon;
+        if (!changed) continue;
+
+        appliedVolumes[i] = volume;
+        appliedPans[i] = pans[i];
+        virtualized[i] = isVirtual ? 1 : 0;
+        apply(handles[i], volume, pans[i], isVirtual);
+    }
+}
+
+template <typename IsAliveFn>
+void SpatialVoiceSet::prune(IsAliveFn&& isAlive) {
+    for (size_t i = handles.size(); i-- > 0;) {
+        if (!isAlive(handles[i])) {
+            removeAt(i);
+        }
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,164 @@
+#include "voice_pool.h"
+#include <algorithm>
+
+namespace Engine {
+
+VoicePool::VoicePool(uint32_t maxVoices)
+    : maxVoices(maxVoices) {
+    groups.push_back(SoundGroupConfig{});
+    voices.reserve(maxVoices);
+}
+
+uint32_t VoicePool::addGroup(const SoundGroupConfig& config) {
+    groups.push_back(config);
+    return static_cast<uint32_t>(groups.size() - 1);
+}
+
+void VoicePool::setGroupConfig(uint32_t group, const SoundGroupConfig& config) {
+    groups[resolveGroup(group)] = config;
+}
+
+const SoundGroupConfig& VoicePool::getGroupConfig(uint32_t group) const {
+    return groups[resolveGroup(group)];
+}
+
+uint32_t VoicePool::getGroupVoiceCount(uint32_t group) const {
+    group = resolveGroup(group);
+    return static_cast<uint32_t>(std::count_if(voices.begin(), voices.end(),
+        [group](const ActiveVoice& v) { return v.group == group; }));
+}
+
+uint32_t VoicePool::getVoiceGroup(VoiceHandle handle) const {
+    for (const auto& voice : voices) {
+        if (voice.handle == handle) return voice.group;
+    }
+    return kDefaultGroup;
+}
+
+VoiceAdmission VoicePool::admit(uint32_t group, float volume) {
+    const VoiceAdmission admission = evaluate(group, volume);
+    recordAdmission(admission);
+    return admission;
+}
+
+VoiceAdmission VoicePool::evaluate(uint32_t group, float volume) const {
+    group = resolveGroup(group);
+    const SoundGroupConfig& config = groups[group];
+
+    VoiceAdmission result;
+    result.volume = volume * config.volume;
+
+    if (result.volume < minAudibleVolume) {
+        result.decision = VoiceDecision::Cull;
+        return result;
+    }
+
+    // Group limit: only voices of the same group are candidates.
+    if (config.maxInstances > 0 && getGroupVoiceCount(group) >= config.maxInstances) {
+        const ActiveVoice* oldest = config.stealOldest ? findOldestInGroup(group) : nullptr;
+        if (!oldest) {
+            result.decision = VoiceDecision::Reject;
+            return result;
+        }
+        result.decision = VoiceDecision::Steal;
+        result.victim = oldest->handle;
+        return result;
+    }
+
+    if (voices.size() < maxVoices) {
+        result.decision = VoiceDecision::Play;
+        return result;
+    }
+
+    // Global budget: steal the least important voice if the request outranks it.
+    const ActiveVoice* candidate = findStealCandidate();
+    const bool outranks = candidate &&
+        (candidate->priority < config.priority ||
+         (candidate->priority == config.priority && candidate->volume <= result.volume));
+    if (!outranks) {
+        result.decision = VoiceDecision::Reject;
+        return result;
+    }
+
+    result.decision = VoiceDecision::Steal;
+    result.victim = candidate->handle;
+    return result;
+}
+
+void VoicePool::recordAdmission(const VoiceAdmission& admission) {
+    ++stats.playRequests;
+    switch (admission.decision) {
+        case VoiceDecision::Steal: ++stats.stolenVoices; break;
+        case VoiceDecision::Reject: ++stats.rejectedVoices; break;
+        case VoiceDecision::Cull: ++stats.culledVoices; break;
+        case VoiceDecision::Play:
+        default: break;
+    }
+}
+
+void VoicePool::onVoiceStarted(VoiceHandle handle, uint32_t group, float volume) {
+    group = resolveGroup(group);
+    voices.push_back({handle, group, groups[group].priority, volume, nextSerial++});
+    stats.activeVoices = static_cast<uint32_t>(voices.size());
+    stats.peakVoices = std::max(stats.peakVoices, stats.activeVoices);
+}
+
+void VoicePool::onVoiceStopped(VoiceHandle handle) {
+    auto it = std::find_if(voices.begin(), voices.end(),
+        [handle](const ActiveVoice& v) { return v.handle == handle; });
+    if (it != voices.end()) {
+        *it = voices.back();
+        voices.pop_back();
+        stats.activeVoices = static_cast<uint32_t>(voices.size());
+    }
+}
+
+void VoicePool::setVoiceVolume(VoiceHandle handle, float volume) {
+    for (auto& voice : voices) {
+        if (voice.handle == handle) {
+            voice.volume = volume;
+            return;
+        }
+    }
+}
+
+void VoicePool::clear() {
+    voices.clear();
+    stats.activeVoices = 0;
+}
+
+void VoicePool::resetStats() {
+    stats = VoiceStats{};
+    stats.activeVoices = static_cast<uint32_t>(voices.size());
+    stats.peakVoices = stats.activeVoices;
+}
+
+uint32_t VoicePool::resolveGroup(uint32_t group) const {
+    return group < groups.size() ? group : kDefaultGroup;
+}
+
+const VoicePool::ActiveVoice* VoicePool::findOldestInGroup(uint32_t group) const {
+    const ActiveVoice* oldest = nullptr;
+    for (const auto& voice : voices) {
+        if (voice.group == group && (!oldest || voice.serial < oldest->serial)) {
+            oldest = &voice;
+        }
+    }
+    return oldest;
+}
+
+const VoicePool::ActiveVoice* VoicePool::findStealCandidate() const {
+    // Lowest priority first, then quietest, then oldest.
+    const ActiveVoice* best = nullptr;
+    for (const auto& voice : voices) {
+        if (!best ||
+            voice.priority < best->priority ||
+            (voice.priority == best->priority && voice.volume < best->volume) ||
+            (voice.priority == best->priority && voice.volume == best->volume && voice.serial < best->serial)) {
+            best = &voice;
+        }
+    }
+    return best;
+}
+
+} // namespace Engine
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Playback limits shared by every sound assigned to a group
+struct SoundGroupConfig {
+    uint32_t maxInstances = 0;   // Concurrent voices allowed in this group (0 = unlimited)
+    int priority = 0;            // Higher priority voices may steal from lower ones
+    float volume = 1.0f;         // Group volume multiplier
+    bool stealOldest = true;     // At the group limit, replace the oldest voice instead of rejecting
+};
+
+struct VoiceStats {
+    uint32_t activeVoices = 0;
+    uint32_t peakVoices = 0;
+    uint64_t playRequests = 0;
+    uint64_t stolenVoices = 0;   // Voices stopped to make room for a new one
+    uint64_t rejectedVoices = 0; // Requests refused by group or global limits
+    uint64_t culledVoices = 0;   // Requests below the audible volume threshold
+};
+
+enum class VoiceDecision {
+    Play,    // Free slot available
+    Steal,   // Play after stopping `victim`
+    Reject,  // Limits reached and nothing could be stolen
+    Cull     // Too quiet to be worth mixing
+};
+
+struct VoiceAdmission {
+    VoiceDecision decision = VoiceDecision::Reject;
+    unsigned int victim = 0;     // Voice handle to stop when decision == Steal
+    float volume = 0.0f;         // Effective volume (request * group)
+
+    bool accepted() const {
+        return decision == VoiceDecision::Play || decision == VoiceDecision::Steal;
+    }
+};
+
+// Bookkeeping for live voices: per-group instance limits, a global voice
+// budget and priority-based stealing. Knows nothing about the mixer; the
+// owner starts/stops voices and reports them back.
+class VoicePool {
+public:
+    using VoiceHandle = unsigned int;
+    static constexpr uint32_t kDefaultGroup = 0;
+
+    explicit VoicePool(uint32_t maxVoices = 32);
+
+    // Global budget
+    void setMaxVoices(uint32_t max) { maxVoices = max; }
+    uint32_t getMaxVoices() const { return maxVoices; }
+    void setMinAudibleVolume(float volume) { minAudibleVolume = volume; }
+    float getMinAudibleVolume() const { return minAudibleVolume; }
+
+    // Groups (group 0 always exists and is unlimited)
+    uint32_t addGroup(const SoundGroupConfig& config);
+    void setGroupConfig(uint32_t group, const SoundGroupConfig& config);
+    const SoundGroupConfig& getGroupConfig(uint32_t group) const;
+    size_t getGroupCount() const { return groups.size(); }
+    uint32_t getGroupVoiceCount(uint32_t group) const;
+    uint32_t getVoiceGroup(VoiceHandle handle) const;  // kDefaultGroup if unknown
+
+    // Admission: call before starting a voice, then report the outcome.
+    // admit() is evaluate() + recordAdmission(); callers that retry (e.g.
+    // after pruning) evaluate until they settle and record once.
+    VoiceAdmission admit(uint32_t group, float volume);
+    VoiceAdmission evaluate(uint32_t group, float volume) const;
+    void recordAdmission(const VoiceAdmission& admission);
+    void onVoiceStarted(VoiceHandle handle, uint32_t group, float volume);
+    void onVoiceStopped(VoiceHandle handle);
+    void setVoiceVolume(VoiceHandle handle, float volume);
+
+    // Drop voices the mixer has finished with (isAlive(handle) -> bool)
+    template <typename IsAliveFn>
+    void prune(IsAliveFn&& isAlive);
+    void clear();
+
+    size_t getActiveCount() const { return voices.size(); }
+    const VoiceStats& getStats() const { return stats; }
+    void resetStats();
+
+private:
+    struct ActiveVoice {
+        VoiceHandle handle;
+        uint32_t group;
+        int priority;
+        float volume;
+        uint64_t serial;  // Start order, lower = older
+    };
+
+    std::vector<ActiveVoice> voices;
+    std::vector<SoundGroupConfig> groups;
+    VoiceStats stats;
+    uint32_t maxVoices;
+    float minAudibleVolume = 0.01f;
+    uint64_t nextSerial = 0;
+
+    uint32_t resolveGroup(uint32_t group) const;
+    const ActiveVoice* findOldestInGroup(uint32_t group) const;
+    const ActiveVoice* findStealCandidate() const;
+};
+
+template <typename IsAliveFn>
+void VoicePool::prune(IsAliveFn&& isAlive) {
+    size_t write = 0;
+    for (size_t read = 0; read < voices.size(); ++read) {
+        if (isAlive(voices[read].handle)) {
+            voices[write++] = voices[read];
+        }
+    }
+    voices.resize(write);
+    stats.activeVoices = static_cast<uint32_t>(voices.size());
+}
+
+} // namespace Engine
@@ -0,0 +1,71 @@
+#include "affine2d.h"
+#include <cmath>
+
+namespace Engine {
+
+Affine2D Affine2D::fromTRS(const Vec2& position, float sinR, float cosR, const Vec2& scale) {
+    Affine2D result;
+    result.a = cosR * scale.x;
+    result.b = sinR * scale.x;
+    result.c = -sinR * scale.y;
+    result.d = cosR * scale.y;
+    result.tx = position.x;
+    result.ty = position.y;
+    return result;
+}
+
+Affine2D Affine2D::translation(const Vec2& offset) {
+    Affine2D result;
+    result.tx = offset.x;
+    result.ty = offset.y;
+    return result;
+}
+
+Affine2D Affine2D::inverse() const {
+    const float det = determinant();
+    if (std::abs(det) < 1e-12f) {
+        return Affine2D{};
+    }
+
+    const float invDet = 1.0f / det;
+    Affine2D result;
+    result.a = d * invDet;
+    result.b = -b * invDet;
+    result.c = -c * invDet;
+    result.d = a * invDet;
+    result.tx = -(result.a * tx + result.c * ty);
+    result.ty = -(result.b * tx + result.d * ty);
+    return result;
+}
+
+Mat4 Affine2D::toMatrix() const {
+    Mat4 mat(1.0f);
+    mat[0][0] = a;
+    mat[0][1] = b;
+    mat[1][0] = c;
+    mat[1][1] = d;
+    mat[3][0] = tx;
+    mat[3][1] = ty;
+    return mat;
+}
+
+Affine2D Affine2D::operator*(const Affine2D& rhs) const {
+    Affine2D result;
+    result.a = a * rhs.a + c * rhs.b;
+    result.b = b * rhs.a + d * rhs.b;
+    result.c = a * rhs.c + c * rhs.d;
+    result.d = b * rhs.c + d * rhs.d;
+    result.tx = a * rhs.tx + c * rhs.ty + tx;
+    result.ty = b * rhs.tx + d * rhs.ty + ty;
+    return result;
+}
+
+bool Affine2D::operator==(const Affine2D& other) const {
+    constexpr float epsilon = 0.001f;
+
+    return std::abs(a - other.a) < epsilon && std::abs(b - other.b) < epsilon &&
+           std::abs(c - other.c) < epsilon && std::abs(d - other.d) < epsilon &&
+           std::abs(tx - other.tx) < epsilon && std::abs(ty - other.ty) < epsilon;
+}
+
+} // namespace Engine
@@ -0,0 +1,57 @@
+#include "frame_allocator.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+FrameAllocator::FrameAllocator(size_t bytesPerFrame) {
+    for (Buffer& buffer : buffers) {
+        buffer.capacity = bytesPerFrame;
+        buffer.memory = std::make_unique<std::byte[]>(bytesPerFrame);
+    }
+}
+
+void* FrameAllocator::allocate(size_t size, size_t alignment) {
+    // new[] blocks are aligned for max_align_t; offsets are aligned relative to them.
+    alignment = std::max(alignment, size_t{1});
+    Buffer& buffer = buffers[current];
+    const size_t offset = alignUp(buffer.used, alignment);
+    if (alignment <= alignof(std::max_align_t) && offset + size <= buffer.capacity) {
+        buffer.used = offset + size;
+        peakBytes = std::max(peakBytes, getUsedBytes());
+        return buffer.memory.get() + offset;
+    }
+
+    // Overflow: own block, freed when this buffer is reset.
+    ++overflowCount;
+    const size_t padded = size + alignment;
+    buffer.overflow.push_back(std::make_unique<std::byte[]>(padded));
+    buffer.overflowBytes += padded;
+    peakBytes = std::max(peakBytes, getUsedBytes());
+    const auto address = reinterpret_cast<uintptr_t>(buffer.overflow.back().get());
+    return buffer.overflow.back().get() + (alignUp(address, alignment) - address);
+}
+
+void FrameAllocator::beginFrame() {
+    lastFrameBytes = getUsedBytes();
+    ++frameCount;
+    current ^= 1;
+
+    // The buffer being reused held the frame before last; nothing references it now.
+    Buffer& buffer = buffers[current];
+    const size_t needed = buffer.used + buffer.overflowBytes;
+    if (!buffer.overflow.empty() && needed > buffer.capacity) {
+        buffer.capacity = needed;
+        buffer.memory = std::make_unique<std::byte[]>(needed);
+    }
+    buffer.overflow.clear();
+    buffer.overflowBytes = 0;
+    buffer.used = 0;
+}
+
+} // namespace Engine
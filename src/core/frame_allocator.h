@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+// Double-buffered bump arena for data that lives at most two frames.
+// allocate() is a pointer bump; nothing is freed individually. beginFrame()
+// switches to the other buffer and resets it, so data from the previous
+// frame stays valid while the current one is built (e.g. a RenderPacket
+// recorded on the render thread). Requests that do not fit go to heap
+// overflow blocks; the next reset of that buffer grows it to the peak, so
+// steady-state frames never touch the heap. Not thread-safe.
+class FrameAllocator {
+public:
+    explicit FrameAllocator(size_t bytesPerFrame = 1024 * 1024);
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Destructors are never run; only for trivially destructible types
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameAllocator never runs destructors");
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    void beginFrame();
+
+    size_t getCapacity() const { return buffers[current].capacity; }  // Of the current buffer
+    size_t getUsedBytes() const { return buffers[current].used + buffers[current].overflowBytes; }
+    size_t getPeakBytes() const { return peakBytes; }           // Largest frame so far
+    size_t getLastFrameBytes() const { return lastFrameBytes; }
+    uint64_t getOverflowCount() const { return overflowCount; }  // Allocations that missed the arena
+    uint64_t getFrameCount() const { return frameCount; }
+
+private:
+    struct Buffer {
+        std::unique_ptr<std::byte[]> memory;
+        size_t capacity = 0;
+        size_t used = 0;
+        std::vector<std::unique_ptr<std::byte[]>> overflow;
+        size_t overflowBytes = 0;
+    };
+
+    Buffer buffers[2];
+    uint32_t current = 0;
+    size_t peakBytes = 0;
+    size_t lastFrameBytes = 0;
+    uint64_t overflowCount = 0;
+    uint64_t frameCount = 0;
+};
+
+// STL allocator over a FrameAllocator; deallocate() is a no-op.
+// Containers using it must not outlive the frame after next.
+template <typename T>
+class FrameStlAllocator {
+public:
+    using value_type = T;
+
+    explicit FrameStlAllocator(FrameAllocator& arena) noexcept : arena(&arena) {}
+    template <typename U>
+    FrameStlAllocator(const FrameStlAllocator<U>& other) noexcept : arena(other.getArena()) {}
+
+    T* allocate(size_t count) { return arena->allocateArray<T>(count); }
+    void deallocate(T*, size_t) noexcept {}
+
+    FrameAllocator* getArena() const noexcept { return arena; }
+
+    template <typename U>
+    bool operator==(const FrameStlAllocator<U>& other) const noexcept { return arena == other.getArena(); }
+    template <typename U>
+    bool operator!=(const FrameStlAllocator<U>& other) const noexcept { return arena != other.getArena(); }
+
+private:
+    FrameAllocator* arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+
+template <typename T>
+FrameVector<T> makeFrameVector(FrameAllocator& arena, size_t reserve = 0) {
+    FrameVector<T> result{FrameStlAllocator<T>(arena)};
+    result.reserve(reserve);
+    return result;
+}
+
+} // namespace Engine
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+// Generational handle into a HandlePool. The tag keeps handles of
+// different pools from being mixed up; a default handle is invalid.
+template <typename Tag>
+struct PoolHandle {
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    uint32_t index = kInvalidIndex;  // Slot; stable for the object's lifetime
+    uint32_t generation = 0;         // Bumped when the slot is freed
+
+    bool isValid() const { return index != kInvalidIndex; }
+    bool operator==(const PoolHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+};
+
+// Dense object storage addressed by generational handles.
+// Live objects sit contiguously (iteration is a linear walk); destroy()
+// moves the last object into the hole, and the slot table keeps every
+// handle pointing at its object. A destroyed object's handle never
+// resolves again, even after its slot is reused. Pointers and iteration
+// order are invalidated by create() and destroy(); handles are not.
+template <typename T, typename Tag = T>
+class HandlePool {
+public:
+    using Handle = PoolHandle<Tag>;
+
+    HandlePool() = default;
+    explicit HandlePool(size_t capacity) { reserve(capacity); }
+
+    void reserve(size_t capacity) {
+        objects.reserve(capacity);
+        denseToSlot.reserve(capacity);
+        slots.reserve(capacity);
+    }
+
+    template <typename... Args>
+    Handle create(Args&&... args) {
+        uint32_t slot;
+        if (freeHead != kNone) {
+            slot = freeHead;
+            freeHead = slots[slot].nextFree;
+        } else {
+            slot = static_cast<uint32_t>(slots.size());
+            slots.push_back(Slot{});
+        }
+        slots[slot].dense = static_cast<uint32_t>(objects.size());
+        objects.emplace_back(std::forward<Args>(args)...);
+        denseToSlot.push_back(slot);
+        return Handle{slot, slots[slot].generation};
+    }
+
+    bool destroy(Handle handle) {
+        if (!contains(handle)) return false;
+        Slot& slot = slots[handle.index];
+        const uint32_t dense = slot.dense;
+        const uint32_t last = static_cast<uint32_t>(objects.size() - 1);
+        if (dense != last) {
+            objects[dense] = std::move(objects[last]);
+            denseToSlot[dense] = denseToSlot[last];
+            slots[denseToSlot[dense]].dense = dense;
+        }
+        objects.pop_back();
+        denseToSlot.pop_back();
+
+        ++slot.generation;
+        slot.dense = kNone;
+        slot.nextFree = freeHead;
+        freeHead = handle.index;
+        return true;
+    }
+
+    bool contains(Handle handle) const {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation &&
+               slots[handle.index].dense != kNone;
+    }
+
+    T* get(Handle handle) { return contains(handle) ? &objects[slots[handle.index].dense] : nullptr; }
+    const T* get(Handle handle) const { return contains(handle) ? &objects[slots[handle.index].dense] : nullptr; }
+
+    // Current handle of a live slot (invalid if the slot is free)
+    Handle getHandle(uint32_t slotIndex) const {
+        if (slotIndex >= slots.size() || slots[slotIndex].dense == kNone) return Handle{};
+        return Handle{slotIndex, slots[slotIndex].generation};
+    }
+    // Handle of the object at a dense position, for use while iterating
+    Handle handleAt(size_t denseIndex) const {
+        const uint32_t slot = denseToSlot[denseIndex];
+        return Handle{slot, slots[slot].generation};
+    }
+
+    void clear() {
+        // Bump every live slot so outstanding handles go stale.
+        for (uint32_t slot : denseToSlot) {
+            ++slots[slot].generation;
+            slots[slot].dense = kNone;
+            slots[slot].nextFree = freeHead;
+            freeHead = slot;
+        }
+        objects.clear();
+        denseToSlot.clear();
+    }
+
+    size_t size() const { return objects.size(); }
+    bool empty() const { return objects.empty(); }
+    size_t getSlotCount() const { return slots.size(); }  // Upper bound for Handle::index
+
+    // Dense iteration over live objects
+    T* begin() { return objects.data(); }
+    T* end() { return objects.data() + objects.size(); }
+    const T* begin() const { return objects.data(); }
+    const T* end() const { return objects.data() + objects.size(); }
+    T& operator[](size_t denseIndex) { return objects[denseIndex]; }
+    const T& operator[](size_t denseIndex) const { return objects[denseIndex]; }
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    struct Slot {
+        uint32_t dense = kNone;     // Position in objects; kNone while free
+        uint32_t generation = 0;
+        uint32_t nextFree = kNone;  // Free list link while free
+    };
+
+    std::vector<T> objects;
+    std::vector<uint32_t> denseToSlot;  // Parallel to objects
+    std::vector<Slot> slots;
+    uint32_t freeHead = kNone;
+};
+
+} // namespace Engine
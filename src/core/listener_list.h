@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+// Id-addressed callbacks that may be added or removed while they are being
+// dispatched. A listener removed during dispatch is not called again, even
+// later in the same dispatch; one added during dispatch is first called on
+// the next one. Removed entries are compacted once dispatch unwinds.
+template <typename... Args>
+class ListenerList {
+public:
+    using Id = uint32_t;  // 0 is never returned
+    using Fn = std::function<void(Args...)>;
+
+    Id add(Fn listener) {
+        const Id id = nextId++;
+        listeners.push_back({id, std::move(listener)});
+        return id;
+    }
+
+    void remove(Id id) {
+        for (Entry& entry : listeners) {
+            if (entry.id == id) {
+                entry.id = 0;
+                entry.fn = nullptr;  // Releases captures now, even mid-dispatch
+                hasRemoved = true;
+            }
+        }
+        compact();
+    }
+
+    void dispatch(Args... args) {
+        ++dispatchDepth;
+        // Index loop: listeners may append (and reallocate) meanwhile.
+        const size_t count = listeners.size();
+        for (size_t i = 0; i < count; ++i) {
+            if (listeners[i].id != 0) {
+                Fn fn = listeners[i].fn;  // The listener may remove itself
+                fn(args...);
+            }
+        }
+        --dispatchDepth;
+        compact();
+    }
+
+    size_t size() const {
+        size_t live = 0;
+        for (const Entry& entry : listeners) {
+            live += entry.id != 0;
+        }
+        return live;
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Entry {
+        Id id;
+        Fn fn;
+    };
+
+    std::vector<Entry> listeners;
+    Id nextId = 1;
+    uint32_t dispatchDepth = 0;
+    bool hasRemoved = false;
+
+    void compact() {
+        if (dispatchDepth > 0 || !hasRemoved) return;
+        std::erase_if(listeners, [](const Entry& entry) { return entry.id == 0; });
+        hasRemoved = false;
+    }
+};
+
+} // namespace Engine
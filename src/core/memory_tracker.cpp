@@ -0,0 +1,174 @@
+#include "memory_tracker.h"
+#include "platform/logging.h"
+#include <cstdlib>
+#include <new>
+
+namespace Engine {
+
+namespace {
+thread_local MemoryTag currentTag = MemoryTag::General;
+
+size_t index(MemoryTag tag) {
+    const size_t i = static_cast<size_t>(tag);
+    return i < kMemoryTagCount ? i : 0;
+}
+} // namespace
+
+const char* toString(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::General: return "General";
+        case MemoryTag::Rendering: return "Rendering";
+        case MemoryTag::Audio: return "Audio";
+        case MemoryTag::Animation: return "Animation";
+        case MemoryTag::Assets: return "Assets";
+        case MemoryTag::Scene: return "Scene";
+        default: return "Unknown";
+    }
+}
+
+MemoryTracker& MemoryTracker::get() {
+    // Never destroyed: operator delete may still run during static destruction.
+    static MemoryTracker* tracker = new (std::malloc(sizeof(MemoryTracker))) MemoryTracker();
+    return *tracker;
+}
+
+bool MemoryTracker::isHooked() {
+#ifdef ENGINE_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+MemoryTag MemoryTracker::getCurrentTag() {
+    return currentTag;
+}
+
+void MemoryTracker::setCurrentTag(MemoryTag tag) {
+    currentTag = tag;
+}
+
+void MemoryTracker::recordAllocation(MemoryTag tag, size_t bytes) {
+    // Must not allocate: called from operator new.
+    Counters& c = counters[index(tag)];
+    const auto size = static_cast<int64_t>(bytes);
+    const int64_t live = c.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    int64_t peak = c.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !c.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    c.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.frameBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::recordFree(MemoryTag tag, size_t bytes) {
+    Counters& c = counters[index(tag)];
+    c.liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    c.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setBudget(MemoryTag tag, uint64_t bytes) {
+    Counters& c = counters[index(tag)];
+    c.budgetBytes = bytes;
+    c.overBudget = false;
+}
+
+void MemoryTracker::endFrame() {
+    ++frameCount;
+    const bool steady = frameCount > config.warmupFrames;
+
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        Counters& c = counters[i];
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        c.lastFrameAllocations = c.frameAllocations.exchange(0, std::memory_order_relaxed);
+        c.lastFrameBytes = c.frameBytes.exchange(0, std::memory_order_relaxed);
+
+        // Report on entering a spike, not on every frame of a long one.
+        const bool spiking = steady && (c.lastFrameAllocations > config.spikeAllocationsPerFrame ||
+                                        c.lastFrameBytes > config.spikeBytesPerFrame);
+        if (spiking) {
+            ++spikeCount;
+            if (!c.spiking) {
+                Log::warn("Memory: {} made {} allocations ({} KB) in frame {}", toString(tag),
+                          c.lastFrameAllocations, c.lastFrameBytes / 1024, frameCount);
+            }
+        }
+        c.spiking = spiking;
+
+        const int64_t live = c.liveBytes.load(std::memory_order_relaxed);
+        const bool overBudget = c.budgetBytes > 0 && live > static_cast<int64_t>(c.budgetBytes);
+        if (overBudget && !c.overBudget) {
+            Log::warn("Memory: {} is over budget ({} / {} KB)", toString(tag), live / 1024, c.budgetBytes / 1024);
+        }
+        c.overBudget = overBudget;
+    }
+}
+
+MemoryTagStats MemoryTracker::getStats(MemoryTag tag) const {
+    const Counters& c = counters[index(tag)];
+    MemoryTagStats stats;
+    stats.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = c.liveAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = c.totalAllocations.load(std::memory_order_relaxed);
+    stats.frameAllocations = c.lastFrameAllocations;
+    stats.frameBytes = c.lastFrameBytes;
+    stats.budgetBytes = c.budgetBytes;
+    stats.overBudget = c.overBudget;
+    return stats;
+}
+
+int64_t MemoryTracker::getTotalLiveBytes() const {
+    int64_t total = 0;
+    for (const Counters& c : counters) {
+        total += c.liveBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryTracker::logSummary() const {
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        const MemoryTagStats stats = getStats(tag);
+        if (stats.totalAllocations == 0) continue;
+        Log::info("Memory: {:<10} live {} KB, peak {} KB, {} allocations", toString(tag), stats.liveBytes / 1024,
+                  stats.peakBytes / 1024, stats.totalAllocations);
+    }
+}
+
+} // namespace Engine
+
+#ifdef ENGINE_TRACK_ALLOCATIONS
+// Global allocation hooks. Each block carries a header with its size and
+// tag so the free is charged back to the tag that allocated it. Array,
+// nothrow and sized forms forward here by default; over-aligned
+// allocations use the library's separate aligned forms and are not tracked.
+namespace {
+struct alignas(std::max_align_t) AllocationHeader {
+    size_t size;
+    Engine::MemoryTag tag;
+};
+} // namespace
+
+void* operator new(size_t size) {
+    void* block = std::malloc(sizeof(AllocationHeader) + size);
+    if (!block) throw std::bad_alloc();
+    auto* header = static_cast<AllocationHeader*>(block);
+    header->size = size;
+    header->tag = Engine::MemoryTracker::getCurrentTag();
+    Engine::MemoryTracker::get().recordAllocation(header->tag, size);
+    return header + 1;
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    auto* header = static_cast<AllocationHeader*>(ptr) - 1;
+    Engine::MemoryTracker::get().recordFree(header->tag, header->size);
+    std::free(header);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+#endif
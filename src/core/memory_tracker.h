@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+
+// Subsystem an allocation is charged to
+enum class MemoryTag : uint8_t {
+    General,
+    Rendering,
+    Audio,
+    Animation,
+    Assets,
+    Scene,
+    Count
+};
+
+constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+const char* toString(MemoryTag tag);
+
+struct MemoryTagStats {
+    int64_t liveBytes = 0;
+    int64_t peakBytes = 0;
+    uint64_t liveAllocations = 0;
+    uint64_t totalAllocations = 0;
+    uint64_t frameAllocations = 0;  // During the last completed frame
+    uint64_t frameBytes = 0;
+    uint64_t budgetBytes = 0;       // 0 = no budget
+    bool overBudget = false;        // As of the last endFrame()
+};
+
+struct MemoryTrackerConfig {
+    uint32_t warmupFrames = 300;  // Loading frames; spikes are only reported after these
+    uint64_t spikeAllocationsPerFrame = 1000;
+    uint64_t spikeBytesPerFrame = 4 * 1024 * 1024;
+};
+
+// Per-tag allocation statistics. With ENGINE_TRACK_ALLOCATIONS, global
+// operator new/delete feed get() and charge each allocation to the calling
+// thread's current tag (see MemoryTagScope); without it, only explicit
+// recordAllocation() calls are counted. Recording is lock-free and safe
+// from any thread; endFrame() and the getters belong to the main thread.
+class MemoryTracker {
+public:
+    MemoryTracker() = default;
+    explicit MemoryTracker(const MemoryTrackerConfig& config) : config(config) {}
+
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    static MemoryTracker& get();
+    static bool isHooked();  // Built with ENGINE_TRACK_ALLOCATIONS
+
+    static MemoryTag getCurrentTag();
+    static void setCurrentTag(MemoryTag tag);
+
+    void configure(const MemoryTrackerConfig& newConfig) { config = newConfig; }
+
+    void recordAllocation(MemoryTag tag, size_t bytes);
+    void recordFree(MemoryTag tag, size_t bytes);
+
+    // Warns once when a tag's live bytes cross it
+    void setBudget(MemoryTag tag, uint64_t bytes);
+
+    // Closes the frame's counters and reports spikes and budget overruns
+    void endFrame();
+
+    MemoryTagStats getStats(MemoryTag tag) const;
+    int64_t getTotalLiveBytes() const;
+    uint64_t getFrameCount() const { return frameCount; }
+    uint64_t getSpikeCount() const { return spikeCount; }  // Tag-frames over a spike threshold
+
+    void logSummary() const;
+
+private:
+    struct Counters {
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> peakBytes{0};
+        std::atomic<uint64_t> liveAllocations{0};
+        std::atomic<uint64_t> totalAllocations{0};
+        std::atomic<uint64_t> frameAllocations{0};
+        std::atomic<uint64_t> frameBytes{0};
+        // Main thread only
+        uint64_t lastFrameAllocations = 0;
+        uint64_t lastFrameBytes = 0;
+        uint64_t budgetBytes = 0;
+        bool overBudget = false;
+        bool spiking = false;
+    };
+
+    MemoryTrackerConfig config;
+    Counters counters[kMemoryTagCount];
+    uint64_t frameCount = 0;
+    uint64_t spikeCount = 0;
+};
+
+// Charges allocations on this thread to a tag until destroyed
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag) : previous(MemoryTracker::getCurrentTag()) {
+        MemoryTracker::setCurrentTag(tag);
+    }
+    ~MemoryTagScope() { MemoryTracker::setCurrentTag(previous); }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag previous;
+};
+
+} // namespace Engine
@@ -1,22 +1,20 @@
 #include "transform.h"
 #include <cmath>
-#include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/epsilon.hpp>
 
 namespace Engine {
 
 Mat4 Transform::toMatrix() const {
-    Mat4 mat = glm::mat4(1.0f);
-    mat = glm::translate(mat, Vec3(position, 0.0f));
-    mat = glm::rotate(mat, toRadians(rotation), Vec3(0.0f, 0.0f, 1.0f));
-    mat = glm::scale(mat, Vec3(scale, 1.0f));
-    return mat;
+    return toAffine().toMatrix();
 }
 
 Vec2 Transform::transformPoint(const Vec2& point) const {
-    Mat4 mat = toMatrix();
-    Vec4 result = mat * Vec4(point, 0.0f, 1.0f);
-    return Vec2(result.x, result.y);
+    return toAffine().apply(point);
+}
+
+Affine2D Transform::toAffine() const {
+    const float rad = toRadians(rotation);
+    return Affine2D::fromTRS(position, std::sin(rad), std::cos(rad), scale);
 }
 
 Transform Transform::operator*(const Transform& other) const {
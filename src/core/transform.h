@@ -1,5 +1,6 @@
 #pragma once
 #include "math/vector.h"
+#include "core/affine2d.h"
 #include "core/types.h"
 
 namespace Engine {
@@ -13,6 +14,12 @@ struct Transform {
     Mat4 toMatrix() const;
     Vec2 transformPoint(const Vec2& point) const;
 
+    // 2x3 form of toMatrix(). Stateless (safe from worker threads); batch
+    // many transforms through TransformHierarchy or toAffines() instead.
+    Affine2D toAffine() const;
+
+    // Componentwise combine (offsets are not rotated or scaled by this
+    // transform). For parent/child attachment use TransformHierarchy.
     Transform operator*(const Transform& other) const;
     bool operator==(const Transform& other) const;
     bool operator!=(const Transform& other) const { return !(*this == other); }
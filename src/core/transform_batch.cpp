@@ -0,0 +1,93 @@
+#include "transform_batch.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_TRANSFORM_SSE2 1
+#endif
+
+namespace Engine {
+
+static_assert(sizeof(Vec2) == 2 * sizeof(float), "Batch paths treat Vec2 arrays as packed floats");
+
+void transformPoints(const Affine2D& transform, std::span<const Vec2> points, std::span<Vec2> out) {
+    const size_t count = std::min(points.size(), out.size());
+    size_t i = 0;
+
+#ifdef ENGINE_TRANSFORM_SSE2
+    // Two points per iteration: (x0 y0 x1 y1) -> xs (x0 x0 x1 x1), ys (y0 y0 y1 y1)
+    const __m128 colX = _mm_setr_ps(transform.a, transform.b, transform.a, transform.b);
+    const __m128 colY = _mm_setr_ps(transform.c, transform.d, transform.c, transform.d);
+    const __m128 translation = _mm_setr_ps(transform.tx, transform.ty, transform.tx, transform.ty);
+    const float* src = reinterpret_cast<const float*>(points.data());
+    float* dst = reinterpret_cast<float*>(out.data());
+    for (; i + 2 <= count; i += 2) {
+        const __m128 xy = _mm_loadu_ps(src + i * 2);
+        const __m128 xs = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, colX), _mm_mul_ps(ys, colY)), translation);
+        _mm_storeu_ps(dst + i * 2, result);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = transform.apply(points[i]);
+    }
+}
+
+void transformPoints(const Transform& transform, std::span<const Vec2> points, std::span<Vec2> out) {
+    transformPoints(transform.toAffine(), points, out);
+}
+
+void transformPoints(std::span<const Affine2D> transforms, std::span<const Vec2> points, std::span<Vec2> out) {
+    const size_t count = std::min({transforms.size(), points.size(), out.size()});
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = transforms[i].apply(points[i]);
+    }
+}
+
+void toAffines(std::span<const Transform> transforms, std::span<Affine2D> out) {
+    const size_t count = std::min(transforms.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = transforms[i].toAffine();
+    }
+}
+
+Rectangle computeWorldBounds(const Affine2D& transform, const Rectangle& local) {
+    // Center maps through the affine; half extents through its absolute value.
+    const float hx = local.width * 0.5f;
+    const float hy = local.height * 0.5f;
+    const float mx = local.x + hx;
+    const float my = local.y + hy;
+
+    const float cx = transform.a * mx + transform.c * my + transform.tx;
+    const float cy = transform.b * mx + transform.d * my + transform.ty;
+    const float ex = std::abs(transform.a) * hx + std::abs(transform.c) * hy;
+    const float ey = std::abs(transform.b) * hx + std::abs(transform.d) * hy;
+    return Rectangle(cx - ex, cy - ey, ex * 2.0f, ey * 2.0f);
+}
+
+void computeWorldBounds(std::span<const Affine2D> transforms, std::span<const Rectangle> locals,
+                        std::span<Rectangle> out) {
+    const size_t count = std::min({transforms.size(), locals.size(), out.size()});
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = computeWorldBounds(transforms[i], locals[i]);
+    }
+}
+
+Rectangle computePointBounds(std::span<const Vec2> points) {
+    if (points.empty()) {
+        return Rectangle();
+    }
+
+    Vec2 minimum = points[0];
+    Vec2 maximum = points[0];
+    for (const Vec2& point : points.subspan(1)) {
+        minimum = glm::min(minimum, point);
+        maximum = glm::max(maximum, point);
+    }
+    return Rectangle(minimum.x, minimum.y, maximum.x - minimum.x, maximum.y - minimum.y);
+}
+
+} // namespace Engine
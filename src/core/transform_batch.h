@@ -0,0 +1,32 @@
+#pragma once
+#include "core/affine2d.h"
+#include "core/transform.h"
+#include "math/rectangle.h"
+#include <span>
+
+namespace Engine {
+
+// Batch versions of Transform::transformPoint and sprite bounds for code that
+// transforms many points per frame (outlines, hitboxes, spawn shapes).
+// Each function processes min(input sizes) elements; `out` may alias the
+// input points.
+
+// Every point through one transform (SSE2 when available)
+void transformPoints(const Affine2D& transform, std::span<const Vec2> points, std::span<Vec2> out);
+void transformPoints(const Transform& transform, std::span<const Vec2> points, std::span<Vec2> out);
+
+// Point i through transform i
+void transformPoints(std::span<const Affine2D> transforms, std::span<const Vec2> points, std::span<Vec2> out);
+
+// Affine form of many transforms, each converted with Transform::toAffine()
+void toAffines(std::span<const Transform> transforms, std::span<Affine2D> out);
+
+// World-space AABB of a local rectangle under a rotated/scaled transform
+Rectangle computeWorldBounds(const Affine2D& transform, const Rectangle& local);
+void computeWorldBounds(std::span<const Affine2D> transforms, std::span<const Rectangle> locals,
+                        std::span<Rectangle> out);
+
+// Tight AABB of a point set (empty rectangle for no points)
+Rectangle computePointBounds(std::span<const Vec2> points);
+
+} // namespace Engine
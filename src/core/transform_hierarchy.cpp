@@ -0,0 +1,276 @@
+#include "transform_hierarchy.h"
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+// Returned by the getters for invalid ids
+const Transform kIdentityTransform{};
+const Affine2D kIdentityAffine{};
+} // namespace
+
+TransformNodeId TransformHierarchy::create(const Transform& local, TransformNodeId parent) {
+    if (parent != kInvalidTransformNode && !isValid(parent)) {
+        parent = kInvalidTransformNode;
+    }
+
+    TransformNodeId id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<TransformNodeId>(slotOf.size());
+        slotOf.push_back(npos);
+        parentOf.push_back(kInvalidTransformNode);
+        firstChild.push_back(kInvalidTransformNode);
+        nextSibling.push_back(kInvalidTransformNode);
+    }
+
+    // Append a slot; a new root at the end keeps the order depth-first,
+    // a new child needs a re-sort before the next update.
+    const uint32_t slot = static_cast<uint32_t>(ids.size());
+    slotOf[id] = slot;
+    ids.push_back(id);
+    parentSlots.push_back(parent == kInvalidTransformNode ? npos : slotOf[parent]);
+    subtreeSizes.push_back(1);
+    locals.push_back(local);
+    localAffines.push_back(local.toAffine());
+    worlds.push_back(localAffines.back());
+    dirty.push_back(1);
+
+    link(id, parent);
+    if (parent != kInvalidTransformNode) {
+        orderDirty = true;
+    }
+    ++liveCount;
+    return id;
+}
+
+void TransformHierarchy::destroy(TransformNodeId node) {
+    if (!isValid(node)) return;
+    unlink(node);
+
+    std::vector<TransformNodeId> stack{node};
+    while (!stack.empty()) {
+        TransformNodeId id = stack.back();
+        stack.pop_back();
+        for (TransformNodeId child = firstChild[id]; child != kInvalidTransformNode; child = nextSibling[child]) {
+            stack.push_back(child);
+        }
+        ids[slotOf[id]] = kInvalidTransformNode;
+        slotOf[id] = npos;
+        parentOf[id] = kInvalidTransformNode;
+        firstChild[id] = kInvalidTransformNode;
+        nextSibling[id] = kInvalidTransformNode;
+        freeIds.push_back(id);
+        --liveCount;
+    }
+    orderDirty = true;
+}
+
+bool TransformHierarchy::isValid(TransformNodeId node) const {
+    return node < slotOf.size() && slotOf[node] != npos;
+}
+
+void TransformHierarchy::clear() {
+    slotOf.clear();
+    parentOf.clear();
+    firstChild.clear();
+    nextSibling.clear();
+    freeIds.clear();
+    ids.clear();
+    parentSlots.clear();
+    subtreeSizes.clear();
+    locals.clear();
+    localAffines.clear();
+    worlds.clear();
+    dirty.clear();
+    liveCount = 0;
+    lastUpdatedCount = 0;
+    orderDirty = false;
+}
+
+bool TransformHierarchy::setParent(TransformNodeId node, TransformNodeId parent) {
+    if (!isValid(node)) return false;
+    if (parent != kInvalidTransformNode) {
+        if (!isValid(parent)) return false;
+        for (TransformNodeId up = parent; up != kInvalidTransformNode; up = parentOf[up]) {
+            if (up == node) return false;  // Would create a cycle
+        }
+    }
+    if (parentOf[node] == parent) return true;
+
+    unlink(node);
+    link(node, parent);
+    markDirty(node);
+    orderDirty = true;
+    return true;
+}
+
+TransformNodeId TransformHierarchy::getParent(TransformNodeId node) const {
+    return isValid(node) ? parentOf[node] : kInvalidTransformNode;
+}
+
+const Transform& TransformHierarchy::getLocal(TransformNodeId node) const {
+    return isValid(node) ? locals[slotOf[node]] : kIdentityTransform;
+}
+
+void TransformHierarchy::setLocal(TransformNodeId node, const Transform& local) {
+    if (!isValid(node)) return;
+    locals[slotOf[node]] = local;
+    markDirty(node);
+}
+
+void TransformHierarchy::setLocalPosition(TransformNodeId node, const Vec2& position) {
+    if (!isValid(node)) return;
+    locals[slotOf[node]].position = position;
+    markDirty(node);
+}
+
+void TransformHierarchy::setLocalRotation(TransformNodeId node, float degrees) {
+    if (!isValid(node)) return;
+    locals[slotOf[node]].rotation = degrees;
+    markDirty(node);
+}
+
+void TransformHierarchy::setLocalScale(TransformNodeId node, const Vec2& scale) {
+    if (!isValid(node)) return;
+    locals[slotOf[node]].scale = scale;
+    markDirty(node);
+}
+
+const Affine2D& TransformHierarchy::getWorld(TransformNodeId node) const {
+    return isValid(node) ? worlds[slotOf[node]] : kIdentityAffine;
+}
+
+Transform TransformHierarchy::getWorldTransform(TransformNodeId node) const {
+    if (!isValid(node)) return kIdentityTransform;
+    const Affine2D& world = getWorld(node);
+    Transform result;
+    result.position = world.getTranslation();
+    result.rotation = toDegrees(std::atan2(world.b, world.a));
+    const float scaleX = std::sqrt(world.a * world.a + world.b * world.b);
+    result.scale = Vec2(scaleX, scaleX > 0.0f ? world.determinant() / scaleX : 0.0f);
+    result.depth = locals[slotOf[node]].depth;
+    return result;
+}
+
+void TransformHierarchy::update() {
+    if (orderDirty) {
+        rebuildOrder();
+    }
+
+    lastUpdatedCount = 0;
+    const uint32_t count = static_cast<uint32_t>(ids.size());
+    for (uint32_t slot = 0; slot < count;) {
+        if (!dirty[slot]) {
+            ++slot;
+            continue;
+        }
+        // A dirty node invalidates its whole (contiguous) subtree.
+        const uint32_t end = slot + subtreeSizes[slot];
+        updateRange(slot, end);
+        lastUpdatedCount += end - slot;
+        slot = end;
+    }
+}
+
+void TransformHierarchy::updateRange(uint32_t begin, uint32_t end) {
+    // Local affines only change for nodes that were edited.
+    for (uint32_t i = begin; i < end; ++i) {
+        if (dirty[i]) {
+            localAffines[i] = locals[i].toAffine();
+        }
+    }
+
+    // Parents precede children, and the range's own parent lies outside it
+    // and is already up to date.
+    for (uint32_t i = begin; i < end; ++i) {
+        const uint32_t parent = parentSlots[i];
+        worlds[i] = parent == npos ? localAffines[i] : worlds[parent] * localAffines[i];
+        dirty[i] = 0;
+    }
+}
+
+void TransformHierarchy::markDirty(TransformNodeId node) {
+    dirty[slotOf[node]] = 1;
+}
+
+void TransformHierarchy::link(TransformNodeId node, TransformNodeId parent) {
+    parentOf[node] = parent;
+    if (parent != kInvalidTransformNode) {
+        nextSibling[node] = firstChild[parent];
+        firstChild[parent] = node;
+    }
+}
+
+void TransformHierarchy::unlink(TransformNodeId node) {
+    const TransformNodeId parent = parentOf[node];
+    if (parent != kInvalidTransformNode) {
+        TransformNodeId* link = &firstChild[parent];
+        while (*link != node) {
+            link = &nextSibling[*link];
+        }
+        *link = nextSibling[node];
+    }
+    parentOf[node] = kInvalidTransformNode;
+    nextSibling[node] = kInvalidTransformNode;
+}
+
+void TransformHierarchy::rebuildOrder() {
+    // Depth-first walk from each root, in current slot order for stability.
+    std::vector<TransformNodeId> order;
+    order.reserve(liveCount);
+    std::vector<TransformNodeId> stack;
+    for (TransformNodeId id : ids) {
+        if (id == kInvalidTransformNode || parentOf[id] != kInvalidTransformNode) continue;
+        stack.push_back(id);
+        while (!stack.empty()) {
+            TransformNodeId current = stack.back();
+            stack.pop_back();
+            order.push_back(current);
+            for (TransformNodeId child = firstChild[current]; child != kInvalidTransformNode; child = nextSibling[child]) {
+                stack.push_back(child);
+            }
+        }
+    }
+
+    const uint32_t count = static_cast<uint32_t>(order.size());
+    std::vector<uint32_t> newParents(count);
+    std::vector<uint32_t> newSizes(count, 1);
+    std::vector<Transform> newLocals(count);
+    std::vector<Affine2D> newLocalAffines(count);
+    std::vector<Affine2D> newWorlds(count);
+    std::vector<uint8_t> newDirty(count);
+
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        const uint32_t old = slotOf[order[slot]];
+        newLocals[slot] = locals[old];
+        newLocalAffines[slot] = localAffines[old];
+        newWorlds[slot] = worlds[old];
+        newDirty[slot] = dirty[old];
+    }
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        slotOf[order[slot]] = slot;
+    }
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        const TransformNodeId parent = parentOf[order[slot]];
+        newParents[slot] = parent == kInvalidTransformNode ? npos : slotOf[parent];
+    }
+    for (uint32_t slot = count; slot-- > 0;) {
+        if (newParents[slot] != npos) {
+            newSizes[newParents[slot]] += newSizes[slot];
+        }
+    }
+
+    ids = std::move(order);
+    parentSlots = std::move(newParents);
+    subtreeSizes = std::move(newSizes);
+    locals = std::move(newLocals);
+    localAffines = std::move(newLocalAffines);
+    worlds = std::move(newWorlds);
+    dirty = std::move(newDirty);
+    orderDirty = false;
+}
+
+} // namespace Engine
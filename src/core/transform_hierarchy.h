@@ -0,0 +1,81 @@
+#pragma once
+#include "core/affine2d.h"
+#include "core/transform.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+using TransformNodeId = uint32_t;
+constexpr TransformNodeId kInvalidTransformNode = UINT32_MAX;
+
+// Parent/child transforms with local/world separation.
+// Nodes live in flat arrays sorted depth-first, so every subtree is a
+// contiguous range and parents always come before their children. Changing a
+// local transform marks the node dirty; update() recomputes only dirty
+// subtrees. Reparenting or destroying re-sorts the arrays lazily in update().
+// Destroyed or unknown ids are tolerated: setters ignore them and getters
+// return the identity transform.
+class TransformHierarchy {
+public:
+    TransformNodeId create(const Transform& local = Transform{},
+                           TransformNodeId parent = kInvalidTransformNode);
+    void destroy(TransformNodeId node);  // Destroys the whole subtree
+    bool isValid(TransformNodeId node) const;
+    void clear();
+
+    // Returns false if `parent` is invalid or inside node's own subtree
+    bool setParent(TransformNodeId node, TransformNodeId parent);
+    TransformNodeId getParent(TransformNodeId node) const;
+
+    // Local space (relative to the parent)
+    const Transform& getLocal(TransformNodeId node) const;
+    void setLocal(TransformNodeId node, const Transform& local);
+    void setLocalPosition(TransformNodeId node, const Vec2& position);
+    void setLocalRotation(TransformNodeId node, float degrees);
+    void setLocalScale(TransformNodeId node, const Vec2& scale);
+
+    // World space, valid after update()
+    const Affine2D& getWorld(TransformNodeId node) const;
+    Vec2 getWorldPosition(TransformNodeId node) const { return getWorld(node).getTranslation(); }
+    // Decomposed world transform; exact unless a non-uniformly scaled parent
+    // has rotated children (shear cannot be represented by Transform).
+    Transform getWorldTransform(TransformNodeId node) const;
+
+    void update();
+
+    size_t size() const { return liveCount; }
+    uint32_t getLastUpdatedCount() const { return lastUpdatedCount; }
+
+private:
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    // Per id (stable handles)
+    std::vector<uint32_t> slotOf;              // npos when the id is free
+    std::vector<TransformNodeId> parentOf;
+    std::vector<TransformNodeId> firstChild;
+    std::vector<TransformNodeId> nextSibling;
+    std::vector<TransformNodeId> freeIds;
+
+    // Per slot, depth-first order
+    std::vector<TransformNodeId> ids;          // kInvalidTransformNode for destroyed slots
+    std::vector<uint32_t> parentSlots;
+    std::vector<uint32_t> subtreeSizes;
+    std::vector<Transform> locals;
+    std::vector<Affine2D> localAffines;
+    std::vector<Affine2D> worlds;
+    std::vector<uint8_t> dirty;
+
+    size_t liveCount = 0;
+    uint32_t lastUpdatedCount = 0;
+    bool orderDirty = false;
+
+    void markDirty(TransformNodeId node);
+    void link(TransformNodeId node, TransformNodeId parent);
+    void unlink(TransformNodeId node);
+    void rebuildOrder();
+    void updateRange(uint32_t begin, uint32_t end);
+};
+
+} // namespace Engine
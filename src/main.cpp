@@ -3,6 +3,10 @@
 #include "platform/window.h"
 #include "rendering/renderer.h"
 #include "rendering/quad_renderer.h"
+#include "rendering/render_pipeline.h"
+#include "rendering/sprite_batch.h"
+#include "rendering/shader_hot_reload.h"
+#include "core/memory_tracker.h"
 #include "core/time_manager.h"
 #include "core/types.h"
 #include "rendering/camera.h"
@@ -10,12 +14,17 @@
 #include "scene/scene_manager.h"
 #include "scene/scene.h"
 #include "input/input_manager.h"
+#include <memory>
+#include <string>
 #include <vector>
 #include <glm/gtc/matrix_transform.hpp>
 
 using namespace Engine;
 
-int main() {
+int main(int argc, char** argv) {
+    // --pipelined: simulate frame N+1 while a render thread records frame N
+    const bool pipelined = argc > 1 && std::string(argv[1]) == "--pipelined";
+
     Platform::init();
     Log::init();
 
@@ -29,6 +38,7 @@ int main() {
     rendererConfig.backend = RendererBackend::Auto;
     rendererConfig.vsync = true;
     rendererConfig.debug = true;
+    rendererConfig.profiling = true;
     Renderer renderer(&window, rendererConfig);
     if (!renderer.isInitialized()) {
         Log::critical("Renderer failed to initialize. Exiting.");
@@ -41,14 +51,20 @@ int main() {
         return 1;
     }
 
+#ifdef ENGINE_SHADER_HOT_RELOAD
+    ShaderHotReload shaderReload;
+    shaderReload.start(ShaderHotReload::defaultConfig());
+#endif
+
     TimeManager time;
     InputManager input(window.getNativeHandle());
+    input.mapAction("toggle_profiler", GLFW_KEY_F3);
 
     // Simple demo scene renders a spinning quad
     class DemoScene : public Scene {
     public:
-        DemoScene(Texture* tex, QuadRenderer* renderer, Camera* cam)
-            : texture(tex), quad(renderer), camera(cam) {}
+        DemoScene(Texture* tex, QuadRenderer* renderer, Camera* cam, const Renderer* target)
+            : texture(tex), quad(renderer), camera(cam), target(target) {}
 
         void update(float dt) override {
             angle += dt;
@@ -80,10 +96,30 @@ int main() {
             }
         }
 
+        void buildRenderPacket(RenderPacket& packet) override {
+            packet.viewProj = camera->getProjection(static_cast<float>(target->width()),
+                                                    static_cast<float>(target->height())) *
+                              camera->getViewMatrix();
+            if (!texture || !texture->isValid()) return;
+
+            SpriteDrawData sprite{};
+            sprite.texture = texture->getHandle();
+            sprite.size = Vec2(128.0f, 128.0f);
+            sprite.uvRect = Vec4(0.0f, 0.0f, 1.0f, 1.0f);
+            sprite.origin = Vec2(64.0f, 64.0f);
+            sprite.color = Color::White;
+
+            Transform transform;
+            transform.position = Vec2(264.0f, 214.0f);
+            transform.rotation = toDegrees(angle);
+            packet.queue.submit(0.0f, sprite, transform);
+        }
+
     private:
         Texture* texture;
         QuadRenderer* quad;
         Camera* camera;
+        const Renderer* target;
         Vec2 camPos{0.0f, 0.0f};
         float angle = 0.0f;
     };
@@ -113,7 +149,18 @@ int main() {
     camera.setZoom(1.0f);
 
     SceneManager scenes;
-    scenes.changeScene(std::make_unique<DemoScene>(&checkerTex, &quadRenderer, &camera));
+    scenes.changeScene(std::make_unique<DemoScene>(&checkerTex, &quadRenderer, &camera, &renderer));
+
+    std::unique_ptr<SpriteBatch> spriteBatch;
+    std::unique_ptr<RenderPipeline> pipeline;
+    if (pipelined) {
+        spriteBatch = std::make_unique<SpriteBatch>();
+        pipeline = std::make_unique<RenderPipeline>(renderer, [&](RenderPacket& packet, bgfx::Encoder* encoder) {
+            packet.queue.sort();
+            packet.queue.render(*spriteBatch, packet.viewProj, bgfx::ViewId{0}, encoder);
+        });
+        Log::info("Pipelined rendering enabled");
+    }
 
     while (window.isOpen()) {
         time.update();
@@ -121,17 +168,43 @@ int main() {
         window.pollEvents();
         input.update(time.getDeltaTime());
 
+        if (input.isActionPressed("toggle_profiler")) {
+            renderer.setProfilerOverlay(!renderer.isProfilerOverlayEnabled());
+        }
         scenes.handleInput(input, time.getDeltaTime());
         scenes.update(time.getDeltaTime());
 
-        renderer.beginFrame();
-        renderer.clear(Color::Blue);
-        scenes.render(renderer);
-        renderer.endFrame();
+#ifdef ENGINE_SHADER_HOT_RELOAD
+        // Frame boundary: swap recompiled programs (not while the render thread uses them)
+        shaderReload.update([&] {
+            if (pipeline) pipeline->flush();
+        });
+#endif
+        if (pipeline) {
+            RenderPacket& packet = pipeline->getSimulationPacket();
+            packet.clearColor = Color::Blue;
+            scenes.buildRenderPacket(packet);
+            pipeline->submitFrame();
+        } else {
+            renderer.beginFrame();
+            renderer.clear(Color::Blue);
+            scenes.render(renderer);
+            renderer.endFrame();
+        }
+        // Per-tag frame counters; warns on allocation spikes once past loading
+        MemoryTracker::get().endFrame();
     }
 
     Log::info("Shutting down...");
+    if (MemoryTracker::isHooked()) {
+        MemoryTracker::get().logSummary();
+    }
+    pipeline.reset();  // Presents the last packet and joins the render thread
+    spriteBatch.reset();
     quadRenderer.shutdown();
+#ifdef ENGINE_SHADER_HOT_RELOAD
+    shaderReload.stop();
+#endif
     Log::shutdown();
     Platform::shutdown();
     return 0;
@@ -79,6 +79,14 @@ void Window::setCloseCallback(std::function<void()> callback) {
     closeCallback = callback;
 }
 
+Window::ResizeListenerId Window::addResizeListener(std::function<void(int, int)> listener) {
+    return resizeListeners.add(std::move(listener));
+}
+
+void Window::removeResizeListener(ResizeListenerId id) {
+    resizeListeners.remove(id);
+}
+
 void Window::glfwResizeCallback(GLFWwindow* window, int width, int height) {
     auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
     self->width = width;
@@ -86,6 +94,7 @@ void Window::glfwResizeCallback(GLFWwindow* window, int width, int height) {
     if (self->resizeCallback) {
         self->resizeCallback(width, height);
     }
+    self->resizeListeners.dispatch(width, height);
 }
 
 void Window::glfwCloseCallback(GLFWwindow* window) {
@@ -1,6 +1,8 @@
 #pragma once
+#include "core/listener_list.h"
 #include "math/vector.h"
 #include <GLFW/glfw3.h>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -37,6 +39,13 @@ public:
     void setResizeCallback(std::function<void(int, int)> callback);
     void setCloseCallback(std::function<void()> callback);
 
+    // Additional resize observers (render targets etc.), called after the
+    // resize callback. Listeners must be removed before they are destroyed;
+    // adding or removing one from inside a resize is fine.
+    using ResizeListenerId = ListenerList<int, int>::Id;
+    ResizeListenerId addResizeListener(std::function<void(int, int)> listener);
+    void removeResizeListener(ResizeListenerId id);
+
 private:
     GLFWwindow* window = nullptr;
     int width{};
@@ -45,6 +54,7 @@ private:
 
     std::function<void(int, int)> resizeCallback;
     std::function<void()> closeCallback;
+    ListenerList<int, int> resizeListeners;
 
     static void glfwResizeCallback(GLFWwindow* window, int width, int height);
     static void glfwCloseCallback(GLFWwindow* window);
@@ -0,0 +1,38 @@
+#include "cached_layer.h"
+
+namespace Engine {
+
+bool CachedLayer::create(Window& window, const RenderTargetConfig& config) {
+    dirty = true;
+    return target.create(window, config);
+}
+
+bool CachedLayer::create(uint16_t width, uint16_t height, const RenderTargetConfig& config) {
+    dirty = true;
+    return target.create(width, height, config);
+}
+
+void CachedLayer::destroy() {
+    target.destroy();
+    dirty = true;
+}
+
+void CachedLayer::beginRedraw(bgfx::ViewId view) const {
+    target.bindToView(view);
+    bgfx::setViewClear(view, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, clearColor, 1.0f, 0);
+    bgfx::touch(view);
+}
+
+SpriteDrawData CachedLayer::getSprite(const Vec2& position, const Color& color) const {
+    SpriteDrawData sprite{};
+    sprite.texture = target.getTexture();
+    sprite.position = position;
+    sprite.size = target.getSize();
+    sprite.uvRect = target.getUvRect();
+    sprite.origin = Vec2(0.0f, 0.0f);
+    sprite.rotation = 0.0f;
+    sprite.color = color;
+    return sprite;
+}
+
+} // namespace Engine
@@ -0,0 +1,60 @@
+#pragma once
+#include "rendering/render_target.h"
+#include "rendering/sprite_batch.h"
+#include <cstdint>
+
+namespace Engine {
+
+// Render-to-texture cache for content that rarely changes (HUD, minimap,
+// parallax backgrounds). The layer is re-rendered only after invalidate() or
+// when its target was recreated (e.g. on window resize); in between,
+// compositing it costs a single sprite.
+class CachedLayer {
+public:
+    bool create(Window& window, const RenderTargetConfig& config = RenderTargetConfig{});
+    bool create(uint16_t width, uint16_t height, const RenderTargetConfig& config = RenderTargetConfig{});
+    void destroy();
+
+    void invalidate() { dirty = true; }
+    bool needsRedraw() const { return dirty || renderedGeneration != target.getGeneration(); }
+    void setClearColor(uint32_t rgba) { clearColor = rgba; dirty = true; }
+
+    // If stale, binds `view` to the layer's target, clears it and calls
+    // draw(view, width, height). Use a view id reserved for this layer.
+    // Returns true if the layer was redrawn.
+    template <typename DrawFn>
+    bool update(bgfx::ViewId view, DrawFn&& draw);
+
+    // Sprite covering the cached texture at `position`, one texel per unit
+    SpriteDrawData getSprite(const Vec2& position, const Color& color = Color::White) const;
+
+    const RenderTarget& getTarget() const { return target; }
+    bgfx::TextureHandle getTexture() const { return target.getTexture(); }
+    uint64_t getRedrawCount() const { return redrawCount; }
+
+private:
+    RenderTarget target;
+    uint32_t clearColor = 0x00000000;  // Transparent, so the layer composites over the scene
+    uint32_t renderedGeneration = 0;
+    uint64_t redrawCount = 0;
+    bool dirty = true;
+
+    void beginRedraw(bgfx::ViewId view) const;
+};
+
+template <typename DrawFn>
+bool CachedLayer::update(bgfx::ViewId view, DrawFn&& draw) {
+    if (!target.isValid() || !needsRedraw()) {
+        return false;
+    }
+
+    beginRedraw(view);
+    draw(view, target.getWidth(), target.getHeight());
+
+    dirty = false;
+    renderedGeneration = target.getGeneration();
+    ++redrawCount;
+    return true;
+}
+
+} // namespace Engine
@@ -0,0 +1,150 @@
+#include "frame_profiler.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+float toMs(int64_t ticks, int64_t frequency) {
+    return frequency > 0 ? static_cast<float>(static_cast<double>(ticks) * 1000.0 / static_cast<double>(frequency)) : 0.0f;
+}
+} // namespace
+
+RollingHistory::RollingHistory(size_t capacity) : values(std::max<size_t>(capacity, 1), 0.0f) {}
+
+void RollingHistory::push(float value) {
+    values[next] = value;
+    next = (next + 1) % values.size();
+    count = std::min(count + 1, values.size());
+}
+
+void RollingHistory::clear() {
+    next = 0;
+    count = 0;
+}
+
+float RollingHistory::at(size_t age) const {
+    if (age >= count) return 0.0f;
+    return values[(next + values.size() - 1 - age) % values.size()];
+}
+
+float RollingHistory::average() const {
+    if (count == 0) return 0.0f;
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += at(i);
+    }
+    return static_cast<float>(sum / static_cast<double>(count));
+}
+
+float RollingHistory::min() const {
+    if (count == 0) return 0.0f;
+    float result = at(0);
+    for (size_t i = 1; i < count; ++i) {
+        result = std::min(result, at(i));
+    }
+    return result;
+}
+
+float RollingHistory::max() const {
+    if (count == 0) return 0.0f;
+    float result = at(0);
+    for (size_t i = 1; i < count; ++i) {
+        result = std::max(result, at(i));
+    }
+    return result;
+}
+
+FrameTimings FrameTimings::fromStats(const bgfx::Stats& stats) {
+    FrameTimings timings;
+    timings.frameMs = toMs(stats.cpuTimeFrame, stats.cpuTimerFreq);
+    timings.waitRenderMs = toMs(stats.waitRender, stats.cpuTimerFreq);
+    timings.waitSubmitMs = toMs(stats.waitSubmit, stats.cpuTimerFreq);
+    timings.cpuMs = std::max(timings.frameMs - timings.waitRenderMs, 0.0f);
+    timings.submitMs = toMs(stats.cpuTimeEnd - stats.cpuTimeBegin, stats.cpuTimerFreq);
+    timings.gpuMs = toMs(stats.gpuTimeEnd - stats.gpuTimeBegin, stats.gpuTimerFreq);
+
+    timings.views.reserve(stats.numViews);
+    for (uint16_t i = 0; i < stats.numViews && stats.viewStats; ++i) {
+        const bgfx::ViewStats& view = stats.viewStats[i];
+        ViewTiming timing;
+        timing.view = view.view;
+        timing.name = view.name;
+        timing.cpuMs = toMs(view.cpuTimeEnd - view.cpuTimeBegin, stats.cpuTimerFreq);
+        timing.gpuMs = toMs(view.gpuTimeEnd - view.gpuTimeBegin, stats.gpuTimerFreq);
+        timings.views.push_back(std::move(timing));
+    }
+    return timings;
+}
+
+FrameProfiler::FrameProfiler(size_t historySize)
+    : historySize(historySize),
+      frame(historySize),
+      cpu(historySize),
+      gpu(historySize),
+      submit(historySize),
+      waitRender(historySize) {}
+
+void FrameProfiler::addFrame(const FrameTimings& timings) {
+    lastFrame = timings;
+    frame.push(timings.frameMs);
+    cpu.push(timings.cpuMs);
+    gpu.push(timings.gpuMs);
+    submit.push(timings.submitMs);
+    waitRender.push(timings.waitRenderMs);
+
+    for (const ViewTiming& timing : timings.views) {
+        auto it = std::lower_bound(views.begin(), views.end(), timing.view,
+            [](const ViewHistory& history, bgfx::ViewId view) { return history.view < view; });
+        if (it == views.end() || it->view != timing.view) {
+            it = views.insert(it, ViewHistory{timing.view, {}, RollingHistory(historySize), RollingHistory(historySize)});
+        }
+        if (!timing.name.empty()) {
+            it->name = timing.name;
+        }
+        it->cpu.push(timing.cpuMs);
+        it->gpu.push(timing.gpuMs);
+    }
+}
+
+void FrameProfiler::clear() {
+    lastFrame = {};
+    frame.clear();
+    cpu.clear();
+    gpu.clear();
+    submit.clear();
+    waitRender.clear();
+    views.clear();
+}
+
+const FrameProfiler::ViewHistory* FrameProfiler::findView(bgfx::ViewId view) const {
+    auto it = std::lower_bound(views.begin(), views.end(), view,
+        [](const ViewHistory& history, bgfx::ViewId id) { return history.view < id; });
+    return it != views.end() && it->view == view ? &*it : nullptr;
+}
+
+FrameBound FrameProfiler::getBound() const {
+    const float gpuMs = gpu.average();
+    const float cpuMs = cpu.average();
+    if (gpuMs <= 0.0f || cpuMs <= 0.0f) {
+        return FrameBound::Unknown;
+    }
+    if (gpuMs > cpuMs * (1.0f + kBoundMargin)) {
+        return FrameBound::Gpu;
+    }
+    if (cpuMs > gpuMs * (1.0f + kBoundMargin)) {
+        return FrameBound::Cpu;
+    }
+    return FrameBound::Balanced;
+}
+
+const char* toString(FrameBound bound) {
+    switch (bound) {
+        case FrameBound::Cpu: return "CPU-bound";
+        case FrameBound::Gpu: return "GPU-bound";
+        case FrameBound::Balanced: return "Balanced";
+        case FrameBound::Unknown:
+        default: return "Unknown";
+    }
+}
+
+} // namespace Engine
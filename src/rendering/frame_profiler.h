@@ -0,0 +1,107 @@
+#pragma once
+#include <bgfx/bgfx.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// Fixed-size history of a per-frame value (milliseconds)
+class RollingHistory {
+public:
+    explicit RollingHistory(size_t capacity = 120);
+
+    void push(float value);
+    void clear();
+
+    size_t size() const { return count; }
+    size_t capacity() const { return values.size(); }
+    bool empty() const { return count == 0; }
+
+    float latest() const { return at(0); }
+    float at(size_t age) const;  // 0 = most recent; 0 when out of range
+    float average() const;
+    float min() const;
+    float max() const;
+
+private:
+    std::vector<float> values;
+    size_t next = 0;
+    size_t count = 0;
+};
+
+struct ViewTiming {
+    bgfx::ViewId view = 0;
+    std::string name;
+    float cpuMs = 0.0f;  // Render thread time submitting the view
+    float gpuMs = 0.0f;  // Lags the CPU by bgfx's GPU latency
+};
+
+struct FrameTimings {
+    float frameMs = 0.0f;       // Main thread time between bgfx::frame() calls
+    float cpuMs = 0.0f;         // frameMs minus time blocked on the render thread
+    float gpuMs = 0.0f;         // Whole-frame GPU time (0 if timer queries are unsupported)
+    float submitMs = 0.0f;      // Render thread time issuing API calls
+    float frameCallMs = 0.0f;   // Duration of the bgfx::frame() call itself
+    float waitRenderMs = 0.0f;  // Main thread waiting for the render thread
+    float waitSubmitMs = 0.0f;  // Render thread waiting for the main thread
+    std::vector<ViewTiming> views;
+
+    // Everything except frameCallMs, which the caller measures
+    static FrameTimings fromStats(const bgfx::Stats& stats);
+};
+
+enum class FrameBound {
+    Unknown,   // No GPU timings yet
+    Cpu,
+    Gpu,
+    Balanced   // Within kBoundMargin of each other
+};
+
+// Rolling per-frame and per-view CPU/GPU timings fed from bgfx::getStats().
+// View GPU times require BGFX_DEBUG_PROFILER (RendererConfig::profiling).
+class FrameProfiler {
+public:
+    struct ViewHistory {
+        bgfx::ViewId view = 0;
+        std::string name;
+        RollingHistory cpu;
+        RollingHistory gpu;
+    };
+
+    // Relative difference between average CPU and GPU time that counts as bound
+    static constexpr float kBoundMargin = 0.1f;
+
+    explicit FrameProfiler(size_t historySize = 120);
+
+    void addFrame(const FrameTimings& timings);
+    void clear();
+
+    const FrameTimings& getLastFrame() const { return lastFrame; }
+    const RollingHistory& getFrameHistory() const { return frame; }
+    const RollingHistory& getCpuHistory() const { return cpu; }
+    const RollingHistory& getGpuHistory() const { return gpu; }
+    const RollingHistory& getSubmitHistory() const { return submit; }
+    const RollingHistory& getWaitRenderHistory() const { return waitRender; }
+
+    const std::vector<ViewHistory>& getViews() const { return views; }  // Sorted by view id
+    const ViewHistory* findView(bgfx::ViewId view) const;
+
+    // Compares average main-thread CPU time against average GPU time
+    FrameBound getBound() const;
+
+private:
+    size_t historySize;
+    FrameTimings lastFrame;
+    RollingHistory frame;
+    RollingHistory cpu;
+    RollingHistory gpu;
+    RollingHistory submit;
+    RollingHistory waitRender;
+    std::vector<ViewHistory> views;
+};
+
+const char* toString(FrameBound bound);
+
+} // namespace Engine
@@ -0,0 +1,240 @@
+#include "image_processing.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_IMAGE_SSE2 1
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define ENGINE_IMAGE_SSSE3 1
+#endif
+
+namespace Engine {
+
+namespace {
+
+constexpr unsigned kMaxThreads = 8;
+
+// Runs fn(begin, end) over [0, count) in contiguous chunks, on several
+// threads when count * pixelsPerItem is large enough to pay for them.
+template <typename Fn>
+void parallelFor(size_t count, size_t pixelsPerItem, const Fn& fn) {
+    const unsigned threads = std::min(std::max(1u, std::thread::hardware_concurrency()), kMaxThreads);
+    if (count * pixelsPerItem < kParallelPixelThreshold || threads <= 1 || count < threads) {
+        fn(size_t{0}, count);
+        return;
+    }
+
+    const size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (size_t begin = chunk; begin < count; begin += chunk) {
+        workers.emplace_back(fn, begin, std::min(count, begin + chunk));
+    }
+    fn(size_t{0}, chunk);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// x * a / 255 rounded to nearest, exact for all 8-bit inputs
+inline uint8_t mulDiv255(uint32_t x, uint32_t a) {
+    const uint32_t t = x * a + 128;
+    return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+}
+
+using Lut = std::array<uint8_t, 256>;
+
+const Lut& srgbToLinearLut() {
+    static const Lut lut = [] {
+        Lut table{};
+        for (int i = 0; i < 256; ++i) {
+            const float c = static_cast<float>(i) / 255.0f;
+            const float linear = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            table[i] = static_cast<uint8_t>(std::lround(linear * 255.0f));
+        }
+        return table;
+    }();
+    return lut;
+}
+
+const Lut& linearToSrgbLut() {
+    static const Lut lut = [] {
+        Lut table{};
+        for (int i = 0; i < 256; ++i) {
+            const float c = static_cast<float>(i) / 255.0f;
+            const float srgb = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+            table[i] = static_cast<uint8_t>(std::lround(srgb * 255.0f));
+        }
+        return table;
+    }();
+    return lut;
+}
+
+void applyColorLut(std::span<uint8_t> rgba, const Lut& lut) {
+    // Table lookups do not vectorize on SSE2; threads carry large images.
+    parallelFor(rgba.size() / 4, 1, [&](size_t begin, size_t end) {
+        uint8_t* p = rgba.data();
+        for (size_t i = begin * 4; i < end * 4; i += 4) {
+            p[i + 0] = lut[p[i + 0]];
+            p[i + 1] = lut[p[i + 1]];
+            p[i + 2] = lut[p[i + 2]];
+        }
+    });
+}
+
+inline void boxPixel(const uint8_t* row0, const uint8_t* row1, uint32_t x0, uint32_t x1, uint8_t* out) {
+    for (int c = 0; c < 4; ++c) {
+        const uint32_t sum = row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] + row1[x1 * 4 + c];
+        out[c] = static_cast<uint8_t>((sum + 2) >> 2);
+    }
+}
+
+} // namespace
+
+void expandRGBToRGBA(std::span<const uint8_t> rgb, std::span<uint8_t> rgba) {
+    const size_t count = std::min(rgb.size() / 3, rgba.size() / 4);
+    parallelFor(count, 1, [&](size_t begin, size_t end) {
+        const uint8_t* src = rgb.data();
+        uint8_t* dst = rgba.data();
+        size_t i = begin;
+
+#ifdef ENGINE_IMAGE_SSSE3
+        // Four pixels per shuffle; the 16-byte load reads one pixel past the
+        // four, so stop early enough to stay inside `rgb`.
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000u));
+        for (; i + 4 <= end && i * 3 + 16 <= rgb.size(); i += 4) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+            const __m128i out = _mm_or_si128(_mm_shuffle_epi8(in, shuffle), alpha);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), out);
+        }
+#endif
+
+        for (; i < end; ++i) {
+            dst[i * 4 + 0] = src[i * 3 + 0];
+            dst[i * 4 + 1] = src[i * 3 + 1];
+            dst[i * 4 + 2] = src[i * 3 + 2];
+            dst[i * 4 + 3] = 255;
+        }
+    });
+}
+
+void premultiplyAlpha(std::span<uint8_t> rgba) {
+    parallelFor(rgba.size() / 4, 1, [&](size_t begin, size_t end) {
+        uint8_t* p = rgba.data();
+        size_t i = begin;
+
+#ifdef ENGINE_IMAGE_SSE2
+        // Four pixels per iteration, widened to 16 bits: two pixels per register.
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i colorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        const __m128i alphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        const __m128i bias = _mm_set1_epi16(128);
+        auto premultiply = [&](__m128i px) {
+            __m128i alpha = _mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3));
+            alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+            alpha = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaOne);  // Alpha * 255 / 255
+            const __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, alpha), bias);
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        };
+        for (; i + 4 <= end; i += 4) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * 4));
+            const __m128i lo = premultiply(_mm_unpacklo_epi8(in, zero));
+            const __m128i hi = premultiply(_mm_unpackhi_epi8(in, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i * 4), _mm_packus_epi16(lo, hi));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            const uint32_t a = p[i * 4 + 3];
+            p[i * 4 + 0] = mulDiv255(p[i * 4 + 0], a);
+            p[i * 4 + 1] = mulDiv255(p[i * 4 + 1], a);
+            p[i * 4 + 2] = mulDiv255(p[i * 4 + 2], a);
+        }
+    });
+}
+
+void srgbToLinear(std::span<uint8_t> rgba) {
+    applyColorLut(rgba, srgbToLinearLut());
+}
+
+void linearToSrgb(std::span<uint8_t> rgba) {
+    applyColorLut(rgba, linearToSrgbLut());
+}
+
+void downsampleBox(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+    const uint32_t dstWidth = std::max(1u, width / 2);
+    const uint32_t dstHeight = std::max(1u, height / 2);
+
+    parallelFor(dstHeight, static_cast<size_t>(width) * 2, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; ++y) {
+            const uint8_t* row0 = src + std::min<size_t>(y * 2, height - 1) * width * 4;
+            const uint8_t* row1 = src + std::min<size_t>(y * 2 + 1, height - 1) * width * 4;
+            uint8_t* out = dst + y * dstWidth * 4;
+            uint32_t x = 0;
+
+#ifdef ENGINE_IMAGE_SSE2
+            // Two output pixels from a 4x2 source block per iteration.
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i bias = _mm_set1_epi16(2);
+            for (; x + 2 <= dstWidth && x * 2 + 4 <= width; x += 2) {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+                // Vertical sums: lo = source pixels 0,1; hi = 2,3
+                const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+                const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+                // Horizontal pairs: (0+1, 2+3) in the low halves
+                const __m128i sums = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+                const __m128i avg = _mm_srli_epi16(_mm_add_epi16(sums, bias), 2);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(avg, zero));
+            }
+#endif
+
+            for (; x < dstWidth; ++x) {
+                const uint32_t x0 = std::min(x * 2, width - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, width - 1);
+                boxPixel(row0, row1, x0, x1, out + x * 4);
+            }
+        }
+    });
+}
+
+uint8_t computeMipCount(uint32_t width, uint32_t height) {
+    uint8_t count = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size /= 2) {
+        ++count;
+    }
+    return count;
+}
+
+size_t computeMipChainSize(uint32_t width, uint32_t height) {
+    size_t bytes = 0;
+    const uint8_t levels = computeMipCount(width, height);
+    for (uint8_t level = 0; level < levels; ++level) {
+        bytes += static_cast<size_t>(width) * height * 4;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> buildMipChain(const uint8_t* rgba, uint32_t width, uint32_t height) {
+    std::vector<uint8_t> chain(computeMipChainSize(width, height));
+    std::copy(rgba, rgba + static_cast<size_t>(width) * height * 4, chain.begin());
+
+    size_t offset = 0;
+    while (width > 1 || height > 1) {
+        const size_t next = offset + static_cast<size_t>(width) * height * 4;
+        downsampleBox(chain.data() + offset, width, height, chain.data() + next);
+        offset = next;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+    return chain;
+}
+
+} // namespace Engine
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine {
+
+// CPU preprocessing for RGBA8 texture data at load or bake time.
+// Pixel loops use SSE2 (SSSE3 for RGB expansion) when available; images
+// with at least kParallelPixelThreshold pixels are split across threads.
+// Each function processes as many whole pixels as its spans hold.
+
+constexpr size_t kParallelPixelThreshold = 512 * 512;
+
+// RGB8 -> RGBA8 with opaque alpha; `rgba` must not alias `rgb`
+void expandRGBToRGBA(std::span<const uint8_t> rgb, std::span<uint8_t> rgba);
+
+// color = color * alpha / 255 (rounded); alpha is unchanged
+void premultiplyAlpha(std::span<uint8_t> rgba);
+
+// Color channels through the sRGB transfer curve; alpha is unchanged.
+// 8-bit in and out, so a round trip loses precision in the darks.
+void srgbToLinear(std::span<uint8_t> rgba);
+void linearToSrgb(std::span<uint8_t> rgba);
+
+// Half-size 2x2 box filter (odd edges repeat the last texel).
+// `dst` holds max(1, width / 2) * max(1, height / 2) pixels.
+void downsampleBox(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+// Levels down to 1x1, including the base level
+uint8_t computeMipCount(uint32_t width, uint32_t height);
+size_t computeMipChainSize(uint32_t width, uint32_t height);
+
+// Every mip level of an RGBA8 image, base level first, in the layout
+// bgfx::createTexture2D expects with hasMips = true. Filter premultiplied
+// data to avoid dark fringes around transparent texels.
+std::vector<uint8_t> buildMipChain(const uint8_t* rgba, uint32_t width, uint32_t height);
+
+} // namespace Engine
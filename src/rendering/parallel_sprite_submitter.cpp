@@ -0,0 +1,134 @@
+#include "parallel_sprite_submitter.h"
+#include "texture_cache.h"
+#include "platform/logging.h"
+#include <algorithm>
+
+namespace Engine {
+
+bool ParallelSpriteSubmitter::init(uint32_t maxLayers, uint32_t maxWorkers) {
+    shutdown();
+
+    if (maxWorkers == 0) {
+        maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // The main-thread encoder counts against the limit as well.
+    const uint32_t encoderLimit = bgfx::getCaps()->limits.maxEncoders;
+    workerCount = std::clamp(maxWorkers, 1u, std::max(encoderLimit, 1u));
+
+    batches.reserve(maxLayers);
+    for (uint32_t i = 0; i < maxLayers; ++i) {
+        batches.push_back(std::make_unique<SpriteBatch>());
+    }
+    stopping = false;
+    for (uint32_t i = 1; i < workerCount; ++i) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+    Log::info("ParallelSpriteSubmitter: {} layers, {} workers", maxLayers, workerCount);
+    return maxLayers > 0;
+}
+
+void ParallelSpriteSubmitter::shutdown() {
+    if (!workers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+    batches.clear();
+}
+
+void ParallelSpriteSubmitter::setupViews(bgfx::ViewId first, uint32_t layerCount, uint16_t width, uint16_t height,
+                                         bgfx::FrameBufferHandle target) {
+    firstView = first;
+    for (uint32_t i = 0; i < layerCount; ++i) {
+        const bgfx::ViewId view = static_cast<bgfx::ViewId>(first + i);
+        bgfx::setViewMode(view, bgfx::ViewMode::Sequential);  // Keep draw order within a layer
+        bgfx::setViewRect(view, 0, 0, width, height);
+        bgfx::setViewFrameBuffer(view, target);
+        bgfx::setViewClear(view, BGFX_CLEAR_NONE);
+    }
+}
+
+void ParallelSpriteSubmitter::submit(uint32_t layerCount, const Mat4& viewProj, const BuildFn& build) {
+    if (layerCount > batches.size()) {
+        Log::warn("ParallelSpriteSubmitter: {} layers requested, {} available", layerCount, batches.size());
+        layerCount = static_cast<uint32_t>(batches.size());
+    }
+    if (layerCount == 0) return;
+
+    jobBuild = &build;
+    jobViewProj = viewProj;
+    jobLayers = layerCount;
+    nextLayer.store(0);
+    activeWorkers = std::min(workerCount, layerCount) - 1;
+    if (activeWorkers > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = activeWorkers;
+            ++generation;
+        }
+        wake.notify_all();
+    }
+
+    bgfx::Encoder* mainEncoder = bgfx::begin();
+    buildLayers(mainEncoder);
+    bgfx::end(mainEncoder);
+
+    if (activeWorkers > 0) {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return running == 0; });
+    }
+    jobBuild = nullptr;
+
+    // TextureResidency is not thread-safe, so workers only record textures.
+    if (textureCache) {
+        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+            for (bgfx::TextureHandle texture : batches[layer]->getUsedTextures()) {
+                textureCache->markUsed(texture);
+            }
+        }
+    }
+}
+
+void ParallelSpriteSubmitter::workerLoop(uint32_t index) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return generation != seen || stopping; });
+            if (stopping) return;
+            seen = generation;
+            if (index > activeWorkers) continue;  // Fewer layers than threads
+        }
+
+        // Out of encoders: leave the layers to the other threads.
+        if (bgfx::Encoder* encoder = bgfx::begin(true)) {
+            buildLayers(encoder);
+            bgfx::end(encoder);
+        }
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            last = --running == 0;
+        }
+        if (last) idle.notify_one();
+    }
+}
+
+void ParallelSpriteSubmitter::buildLayers(bgfx::Encoder* encoder) {
+    // Workers pull layers from a shared counter so uneven layers balance out.
+    for (uint32_t layer = nextLayer.fetch_add(1); layer < jobLayers; layer = nextLayer.fetch_add(1)) {
+        SpriteBatch& batch = *batches[layer];
+        batch.begin(jobViewProj, static_cast<bgfx::ViewId>(firstView + layer), encoder);
+        (*jobBuild)(layer, batch);
+        batch.end();
+    }
+}
+
+} // namespace Engine
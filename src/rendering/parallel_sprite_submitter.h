@@ -0,0 +1,80 @@
+#pragma once
+#include "rendering/sprite_batch.h"
+#include <bgfx/bgfx.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+class TextureCache;
+
+// Builds and submits sprite layers in parallel, one bgfx encoder per
+// worker thread. Layer i is drawn into view firstView + i; the views are
+// sequential and bgfx renders them in id order, so layers composite back
+// to front exactly as if one thread had submitted them. The worker threads
+// are started by init() and sleep between submits.
+class ParallelSpriteSubmitter {
+public:
+    using BuildFn = std::function<void(uint32_t layer, SpriteBatch& batch)>;
+
+    ParallelSpriteSubmitter() = default;
+    ~ParallelSpriteSubmitter() { shutdown(); }
+
+    ParallelSpriteSubmitter(const ParallelSpriteSubmitter&) = delete;
+    ParallelSpriteSubmitter& operator=(const ParallelSpriteSubmitter&) = delete;
+
+    // On the API thread after the renderer is up. maxWorkers 0 = hardware
+    // threads; always capped by the encoder limit. Starts workerCount - 1
+    // threads (the calling thread is the last worker).
+    bool init(uint32_t maxLayers, uint32_t maxWorkers = 0);
+    void shutdown();
+
+    // Views [firstView, firstView + layerCount): same rect and target, no clear
+    void setupViews(bgfx::ViewId firstView, uint32_t layerCount, uint16_t width, uint16_t height,
+                    bgfx::FrameBufferHandle target = BGFX_INVALID_HANDLE);
+
+    // Calls build(layer, batch) once per layer across the workers (the
+    // calling thread takes part) and returns when every layer is submitted.
+    // build must only touch its own batch and thread-safe state.
+    void submit(uint32_t layerCount, const Mat4& viewProj, const BuildFn& build);
+
+    // Textures drawn by the layers are stamped in `cache` on the calling
+    // thread once every layer is done (nullptr to disable).
+    void setTextureCache(TextureCache* cache) { textureCache = cache; }
+
+    uint32_t getMaxLayers() const { return static_cast<uint32_t>(batches.size()); }
+    uint32_t getWorkerCount() const { return workerCount; }
+    bgfx::ViewId getFirstView() const { return firstView; }
+
+private:
+    std::vector<std::unique_ptr<SpriteBatch>> batches;  // One per layer
+    uint32_t workerCount = 1;
+    bgfx::ViewId firstView = 0;
+    TextureCache* textureCache = nullptr;
+
+    // Current submit; written before a new generation is published
+    const BuildFn* jobBuild = nullptr;
+    Mat4 jobViewProj{1.0f};
+    uint32_t jobLayers = 0;
+    uint32_t activeWorkers = 0;  // Pool threads taking part this submit
+    std::atomic<uint32_t> nextLayer{0};
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    uint64_t generation = 0;  // Guarded by mutex; bumped per submit
+    uint32_t running = 0;     // Guarded by mutex; workers still busy
+    bool stopping = false;
+
+    void workerLoop(uint32_t index);
+    void buildLayers(bgfx::Encoder* encoder);
+};
+
+} // namespace Engine
@@ -37,7 +37,8 @@ void QuadRenderer::shutdown() {
     shader.destroy();
 }
 
-void QuadRenderer::draw(const Mat4& viewProj, const Mat4& model, bgfx::TextureHandle texture, const Color& color, uint16_t viewId) {
+void QuadRenderer::draw(const Mat4& viewProj, const Mat4& model, bgfx::TextureHandle texture, const Color& color, uint16_t viewId,
+                        bgfx::Encoder* encoder) {
     if (!bgfx::isValid(u_mvp) || !bgfx::isValid(s_texture) || !bgfx::isValid(shader.getProgram()) || !bgfx::isValid(texture)) {
         Log::warn("QuadRenderer::draw skipped due to invalid handles (uniforms/program/texture)");
         return;
@@ -65,13 +66,17 @@ void QuadRenderer::draw(const Mat4& viewProj, const Mat4& model, bgfx::TextureHa
     std::memcpy(tvb.data, verts, sizeof(verts));
     std::memcpy(tib.data, indices, sizeof(indices));
 
-    bgfx::setTransform(glm::value_ptr(model));
-    bgfx::setVertexBuffer(0, &tvb, 0, 4);
-    bgfx::setIndexBuffer(&tib, 0, 6);
-    bgfx::setTexture(0, s_texture, texture);
-    bgfx::setUniform(u_mvp, glm::value_ptr(viewProj));
-    bgfx::setState(BGFX_STATE_DEFAULT | BGFX_STATE_MSAA);
-    bgfx::submit(viewId, shader.getProgram());
+    bgfx::Encoder* target = encoder ? encoder : bgfx::begin();
+    target->setTransform(glm::value_ptr(model));
+    target->setVertexBuffer(0, &tvb, 0, 4);
+    target->setIndexBuffer(&tib, 0, 6);
+    target->setTexture(0, s_texture, texture);
+    target->setUniform(u_mvp, glm::value_ptr(viewProj));
+    target->setState(BGFX_STATE_DEFAULT | BGFX_STATE_MSAA);
+    target->submit(viewId, shader.getProgram());
+    if (!encoder) {
+        bgfx::end(target);
+    }
 }
 
 } // namespace Engine
@@ -24,7 +24,9 @@ public:
     bool init();
     void shutdown();
 
-    void draw(const Mat4& viewProj, const Mat4& model, bgfx::TextureHandle texture, const Color& color, uint16_t viewId = 0);
+    // Pass an encoder from bgfx::begin(true) to draw from a worker thread
+    void draw(const Mat4& viewProj, const Mat4& model, bgfx::TextureHandle texture, const Color& color, uint16_t viewId = 0,
+              bgfx::Encoder* encoder = nullptr);
 
 private:
     Shader shader;
@@ -0,0 +1,394 @@
+#include "render_graph.h"
+#include "platform/logging.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+// bgfx default BGFX_CONFIG_MAX_VIEWS
+constexpr uint32_t kMaxViews = 256;
+
+uint16_t resolveDimension(uint16_t fixed, uint16_t backbuffer, float scale) {
+    if (fixed != 0) return fixed;
+    return static_cast<uint16_t>(std::max(1.0f, static_cast<float>(backbuffer) * scale));
+}
+} // namespace
+
+bgfx::TextureHandle RenderPassContext::getTexture(RenderResourceId resource) const {
+    return graph->getTexture(resource);
+}
+
+RenderGraph::~RenderGraph() {
+    releaseTargets();
+}
+
+RenderResourceId RenderGraph::createTarget(const std::string& name, const RenderTargetDesc& desc) {
+    Target target;
+    target.name = name;
+    target.desc = desc;
+    targets.push_back(std::move(target));
+    compiled = false;
+    return static_cast<RenderResourceId>(targets.size() - 1);
+}
+
+RenderPassId RenderGraph::addPass(RenderPassDesc desc) {
+    Pass pass;
+    pass.desc = std::move(desc);
+    passes.push_back(std::move(pass));
+    compiled = false;
+    return static_cast<RenderPassId>(passes.size() - 1);
+}
+
+void RenderGraph::addDependency(RenderPassId before, RenderPassId after) {
+    if (before >= passes.size() || after >= passes.size() || before == after) return;
+    passes[after].dependencies.push_back(before);
+    compiled = false;
+}
+
+void RenderGraph::clear() {
+    releaseTargets();
+    passes.clear();
+    targets.clear();
+    physicalTargets.clear();
+    executionOrder.clear();
+    compiled = false;
+}
+
+bool RenderGraph::compile(uint16_t backbufferWidth, uint16_t backbufferHeight) {
+    compiled = false;
+    executionOrder.clear();
+    for (Pass& pass : passes) {
+        pass.viewId = kNoView;
+    }
+    for (const Pass& pass : passes) {
+        if (pass.desc.target != kBackbuffer && pass.desc.target >= targets.size()) {
+            Log::error("RenderGraph: pass '{}' writes unknown target {}", pass.desc.name, pass.desc.target);
+            return false;
+        }
+    }
+
+    linkResources();
+    std::vector<RenderPassId> order;
+    if (!sortPasses(order)) {
+        Log::error("RenderGraph: dependency cycle between passes");
+        return false;
+    }
+
+    const std::vector<uint8_t> live = findLivePasses();
+    for (RenderPassId pass : order) {
+        if (live[pass]) executionOrder.push_back(pass);
+    }
+    if (firstViewId + executionOrder.size() > kMaxViews) {
+        Log::error("RenderGraph: {} passes exceed the bgfx view limit", executionOrder.size());
+        executionOrder.clear();
+        return false;
+    }
+
+    // Consecutive ids in execution order, so bgfx's default view order is correct.
+    for (size_t i = 0; i < executionOrder.size(); ++i) {
+        passes[executionOrder[i]].viewId = static_cast<bgfx::ViewId>(firstViewId + i);
+    }
+
+    for (Target& target : targets) {
+        target.width = resolveDimension(target.desc.width, backbufferWidth, target.desc.scale);
+        target.height = resolveDimension(target.desc.height, backbufferHeight, target.desc.scale);
+    }
+    assignPhysicalTargets();
+
+    compiledWidth = backbufferWidth;
+    compiledHeight = backbufferHeight;
+    compiled = true;
+    return true;
+}
+
+void RenderGraph::linkResources() {
+    const size_t count = passes.size();
+    std::vector<RenderPassId> firstWriter(targets.size(), npos);
+    for (RenderPassId p = 0; p < count; ++p) {
+        const RenderResourceId target = passes[p].desc.target;
+        if (target < targets.size() && firstWriter[target] == npos) {
+            firstWriter[target] = p;
+        }
+    }
+
+    // Per target: writer of the current version and the passes reading it.
+    // Reads declared before any write bind to the first version.
+    std::vector<RenderPassId> lastWriter(targets.size(), npos);
+    std::vector<std::vector<RenderPassId>> readers(targets.size());
+    std::vector<std::vector<RenderPassId>> earlyReaders(targets.size());
+    RenderPassId lastBackbufferWriter = npos;
+
+    for (RenderPassId p = 0; p < count; ++p) {
+        Pass& pass = passes[p];
+        pass.readProducers.clear();
+        pass.producers = pass.dependencies;
+        pass.orderAfter.clear();
+
+        for (RenderResourceId read : pass.desc.reads) {
+            RenderPassId producer = npos;
+            if (read < targets.size()) {
+                if (lastWriter[read] != npos) {
+                    producer = lastWriter[read];
+                    readers[read].push_back(p);
+                } else if (firstWriter[read] != npos && firstWriter[read] != p) {
+                    producer = firstWriter[read];
+                    earlyReaders[read].push_back(p);
+                }
+            }
+            pass.readProducers.push_back(producer);
+            if (producer != npos) pass.producers.push_back(producer);
+        }
+
+        const RenderResourceId target = pass.desc.target;
+        if (target == kBackbuffer) {
+            if (lastBackbufferWriter != npos) pass.orderAfter.push_back(lastBackbufferWriter);
+            lastBackbufferWriter = p;
+            continue;
+        }
+        if (target >= targets.size()) continue;
+
+        if (lastWriter[target] != npos) {
+            pass.orderAfter.push_back(lastWriter[target]);
+            for (RenderPassId reader : readers[target]) {
+                if (reader != p) pass.orderAfter.push_back(reader);
+            }
+            readers[target].clear();
+        } else {
+            readers[target] = std::move(earlyReaders[target]);
+        }
+        lastWriter[target] = p;
+    }
+}
+
+bool RenderGraph::sortPasses(std::vector<RenderPassId>& order) const {
+    // Kahn's algorithm over producer and ordering edges, preferring
+    // declaration order among ready passes.
+    const size_t count = passes.size();
+    std::vector<uint32_t> pending(count, 0);
+    std::vector<std::vector<RenderPassId>> successors(count);
+    for (RenderPassId p = 0; p < count; ++p) {
+        for (const auto* edges : {&passes[p].producers, &passes[p].orderAfter}) {
+            for (RenderPassId pred : *edges) {
+                successors[pred].push_back(p);
+                ++pending[p];
+            }
+        }
+    }
+
+    std::vector<uint8_t> done(count, 0);
+    order.clear();
+    order.reserve(count);
+    while (order.size() < count) {
+        RenderPassId next = npos;
+        for (RenderPassId p = 0; p < count; ++p) {
+            if (!done[p] && pending[p] == 0) {
+                next = p;
+                break;
+            }
+        }
+        if (next == npos) return false;
+
+        done[next] = 1;
+        order.push_back(next);
+        for (RenderPassId succ : successors[next]) {
+            --pending[succ];
+        }
+    }
+    return true;
+}
+
+std::vector<uint8_t> RenderGraph::findLivePasses() const {
+    // Walk back from passes with visible output; everything unreached is culled.
+    const size_t count = passes.size();
+    std::vector<uint8_t> live(count, 0);
+    std::vector<RenderPassId> stack;
+    for (RenderPassId p = 0; p < count; ++p) {
+        if (passes[p].desc.target == kBackbuffer || passes[p].desc.keepAlive) {
+            live[p] = 1;
+            stack.push_back(p);
+        }
+    }
+
+    while (!stack.empty()) {
+        const RenderPassId p = stack.back();
+        stack.pop_back();
+        for (RenderPassId producer : passes[p].producers) {
+            if (!live[producer]) {
+                live[producer] = 1;
+                stack.push_back(producer);
+            }
+        }
+    }
+    return live;
+}
+
+void RenderGraph::assignPhysicalTargets() {
+    // Each version lives from its writer to its last reader (execution-order
+    // indices); a target's lifetime spans all its live versions. A target
+    // read without any writer holds data from outside the graph and is
+    // never shared.
+    constexpr uint32_t kForever = npos - 1;
+    std::vector<uint32_t> position(passes.size(), npos);
+    for (uint32_t i = 0; i < executionOrder.size(); ++i) {
+        position[executionOrder[i]] = i;
+    }
+
+    std::vector<uint32_t> firstUse(targets.size(), npos);
+    std::vector<uint32_t> lastUse(targets.size(), 0);
+    auto extend = [&](RenderResourceId resource, uint32_t from, uint32_t to) {
+        if (resource >= targets.size()) return;
+        firstUse[resource] = std::min(firstUse[resource], from);
+        lastUse[resource] = std::max(lastUse[resource], to);
+    };
+    for (uint32_t i = 0; i < executionOrder.size(); ++i) {
+        const Pass& pass = passes[executionOrder[i]];
+        extend(pass.desc.target, i, i);
+        for (size_t r = 0; r < pass.desc.reads.size(); ++r) {
+            const RenderPassId producer = pass.readProducers[r];
+            if (producer == npos) {
+                extend(pass.desc.reads[r], 0, kForever);
+            } else {
+                extend(pass.desc.reads[r], std::min(position[producer], i), i);
+            }
+        }
+    }
+
+    std::vector<RenderResourceId> byFirstUse;
+    for (RenderResourceId r = 0; r < targets.size(); ++r) {
+        targets[r].physical = npos;
+        if (firstUse[r] != npos) byFirstUse.push_back(r);
+    }
+    std::stable_sort(byFirstUse.begin(), byFirstUse.end(),
+        [&](RenderResourceId a, RenderResourceId b) { return firstUse[a] < firstUse[b]; });
+
+    // Keep previously created framebuffers around so execute() can reuse them.
+    std::vector<PhysicalTarget> previous = std::move(physicalTargets);
+    physicalTargets.clear();
+
+    // Greedy aliasing: reuse a compatible target whose last user ran earlier.
+    for (RenderResourceId r : byFirstUse) {
+        Target& target = targets[r];
+        uint32_t chosen = npos;
+        for (uint32_t i = 0; i < physicalTargets.size(); ++i) {
+            const PhysicalTarget& physical = physicalTargets[i];
+            if (physical.lastUse < firstUse[r] && physical.width == target.width &&
+                physical.height == target.height && physical.format == target.desc.format &&
+                physical.depth == target.desc.depth) {
+                chosen = i;
+                break;
+            }
+        }
+        if (chosen == npos) {
+            PhysicalTarget physical;
+            physical.width = target.width;
+            physical.height = target.height;
+            physical.format = target.desc.format;
+            physical.depth = target.desc.depth;
+            physicalTargets.push_back(physical);
+            chosen = static_cast<uint32_t>(physicalTargets.size() - 1);
+        }
+        physicalTargets[chosen].lastUse = lastUse[r];
+        target.physical = chosen;
+    }
+
+    // Hand matching framebuffers over; the rest are destroyed in execute().
+    for (PhysicalTarget& physical : physicalTargets) {
+        for (PhysicalTarget& old : previous) {
+            if (bgfx::isValid(old.frameBuffer) && old.width == physical.width &&
+                old.height == physical.height && old.format == physical.format &&
+                old.depth == physical.depth) {
+                physical.frameBuffer = old.frameBuffer;
+                old.frameBuffer = BGFX_INVALID_HANDLE;
+                break;
+            }
+        }
+    }
+    for (PhysicalTarget& old : previous) {
+        if (bgfx::isValid(old.frameBuffer)) {
+            retiredFrameBuffers.push_back(old.frameBuffer);
+        }
+    }
+}
+
+void RenderGraph::createFrameBuffers() {
+    for (bgfx::FrameBufferHandle handle : retiredFrameBuffers) {
+        bgfx::destroy(handle);
+    }
+    retiredFrameBuffers.clear();
+
+    for (PhysicalTarget& physical : physicalTargets) {
+        if (bgfx::isValid(physical.frameBuffer)) continue;
+
+        const uint64_t flags = BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
+        if (physical.depth) {
+            bgfx::TextureHandle attachments[2] = {
+                bgfx::createTexture2D(physical.width, physical.height, false, 1, physical.format, flags),
+                bgfx::createTexture2D(physical.width, physical.height, false, 1, bgfx::TextureFormat::D24S8, BGFX_TEXTURE_RT),
+            };
+            physical.frameBuffer = bgfx::createFrameBuffer(2, attachments, true);
+        } else {
+            physical.frameBuffer = bgfx::createFrameBuffer(physical.width, physical.height, physical.format, flags);
+        }
+        if (!bgfx::isValid(physical.frameBuffer)) {
+            Log::error("RenderGraph: failed to create {}x{} render target", physical.width, physical.height);
+        }
+    }
+}
+
+void RenderGraph::releaseTargets() {
+    for (PhysicalTarget& physical : physicalTargets) {
+        if (bgfx::isValid(physical.frameBuffer)) {
+            bgfx::destroy(physical.frameBuffer);
+            physical.frameBuffer = BGFX_INVALID_HANDLE;
+        }
+    }
+    for (bgfx::FrameBufferHandle handle : retiredFrameBuffers) {
+        bgfx::destroy(handle);
+    }
+    retiredFrameBuffers.clear();
+}
+
+bgfx::TextureHandle RenderGraph::getTexture(RenderResourceId resource) const {
+    if (resource >= targets.size() || targets[resource].physical == npos) {
+        return BGFX_INVALID_HANDLE;
+    }
+    const bgfx::FrameBufferHandle frameBuffer = physicalTargets[targets[resource].physical].frameBuffer;
+    if (!bgfx::isValid(frameBuffer)) {
+        return BGFX_INVALID_HANDLE;
+    }
+    return bgfx::getTexture(frameBuffer);
+}
+
+void RenderGraph::execute(uint16_t backbufferWidth, uint16_t backbufferHeight) {
+    if (!compiled || backbufferWidth != compiledWidth || backbufferHeight != compiledHeight) {
+        if (!compile(backbufferWidth, backbufferHeight)) return;
+    }
+    createFrameBuffers();
+
+    for (RenderPassId id : executionOrder) {
+        const Pass& pass = passes[id];
+        const RenderPassDesc& desc = pass.desc;
+
+        uint16_t width = backbufferWidth;
+        uint16_t height = backbufferHeight;
+        bgfx::FrameBufferHandle frameBuffer = BGFX_INVALID_HANDLE;
+        if (desc.target != kBackbuffer) {
+            const Target& target = targets[desc.target];
+            width = target.width;
+            height = target.height;
+            frameBuffer = physicalTargets[target.physical].frameBuffer;
+        }
+
+        bgfx::setViewName(pass.viewId, desc.name.c_str());
+        bgfx::setViewFrameBuffer(pass.viewId, frameBuffer);
+        bgfx::setViewRect(pass.viewId, 0, 0, width, height);
+        bgfx::setViewClear(pass.viewId, desc.clearFlags, desc.clearColor, desc.clearDepth, desc.clearStencil);
+        bgfx::touch(pass.viewId);  // Clears run even if the pass submits nothing
+
+        if (desc.execute) {
+            desc.execute(RenderPassContext{pass.viewId, width, height, this});
+        }
+    }
+}
+
+} // namespace Engine
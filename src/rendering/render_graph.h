@@ -0,0 +1,144 @@
+#pragma once
+#include <bgfx/bgfx.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+using RenderPassId = uint32_t;
+using RenderResourceId = uint32_t;
+
+// The window's backbuffer; always available, never aliased
+constexpr RenderResourceId kBackbuffer = UINT32_MAX;
+
+// Transient render target owned by the graph
+struct RenderTargetDesc {
+    uint16_t width = 0;    // 0 = backbuffer width * scale
+    uint16_t height = 0;   // 0 = backbuffer height * scale
+    float scale = 1.0f;    // Used for 0-sized dimensions (e.g. 0.5 for half-res bloom)
+    bgfx::TextureFormat::Enum format = bgfx::TextureFormat::BGRA8;
+    bool depth = false;    // Adds a D24S8 attachment
+};
+
+class RenderGraph;
+
+struct RenderPassContext {
+    bgfx::ViewId viewId;
+    uint16_t width;
+    uint16_t height;
+    const RenderGraph* graph;
+
+    // Color texture of a target this pass declared in `reads`
+    bgfx::TextureHandle getTexture(RenderResourceId resource) const;
+};
+
+struct RenderPassDesc {
+    std::string name;
+    RenderResourceId target = kBackbuffer;
+    std::vector<RenderResourceId> reads;  // Targets sampled by this pass (adds dependencies)
+
+    uint16_t clearFlags = BGFX_CLEAR_NONE;
+    uint32_t clearColor = 0x000000ff;
+    float clearDepth = 1.0f;
+    uint8_t clearStencil = 0;
+
+    bool keepAlive = false;  // Never culled, even if nothing consumes its output
+    std::function<void(const RenderPassContext&)> execute;
+};
+
+// Lightweight frame graph over bgfx views.
+// Passes declare what they read and write; compile() orders them, culls
+// passes whose output is never used, assigns consecutive bgfx view ids in
+// execution order and lets transient targets with disjoint lifetimes share
+// one framebuffer. Build once, then call execute() every frame; changing
+// the graph or the backbuffer size recompiles on the next execute().
+//
+// Targets are versioned by declaration order: every write starts a new
+// version, and a read consumes the latest version written by a pass
+// declared before the reader (the first version if there is none yet), so
+// ping-pong chains like t1 -> t2 -> t1 are not cycles. Writers of a target
+// keep their declaration order and run after the readers of the version
+// they replace. Writing a target does not consume its previous version:
+// a pass drawing on top of earlier output should read that target too.
+class RenderGraph {
+public:
+    explicit RenderGraph(bgfx::ViewId firstViewId = 0) : firstViewId(firstViewId) {}
+    ~RenderGraph();
+
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    RenderResourceId createTarget(const std::string& name, const RenderTargetDesc& desc);
+    RenderPassId addPass(RenderPassDesc desc);
+    void addDependency(RenderPassId before, RenderPassId after);  // Ordering without a shared target
+    void clear();  // Removes all passes and targets (frees GPU resources)
+
+    // Pure scheduling step; no GPU work. Returns false on cycles, on a pass
+    // writing a target that was never created, or when the graph needs more
+    // views than bgfx provides.
+    bool compile(uint16_t backbufferWidth, uint16_t backbufferHeight);
+    void execute(uint16_t backbufferWidth, uint16_t backbufferHeight);
+    void releaseTargets();  // Frees physical framebuffers (recreated on demand)
+
+    // Results of the last compile()
+    bool isCompiled() const { return compiled; }
+    bool isPassCulled(RenderPassId pass) const { return passes[pass].viewId == kNoView; }
+    bgfx::ViewId getViewId(RenderPassId pass) const { return passes[pass].viewId; }
+    const std::vector<RenderPassId>& getExecutionOrder() const { return executionOrder; }
+    uint32_t getPhysicalTargetIndex(RenderResourceId resource) const { return targets[resource].physical; }
+    size_t getPhysicalTargetCount() const { return physicalTargets.size(); }
+    size_t getPassCount() const { return passes.size(); }
+    bgfx::TextureHandle getTexture(RenderResourceId resource) const;
+
+private:
+    static constexpr bgfx::ViewId kNoView = UINT16_MAX;
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    struct Pass {
+        RenderPassDesc desc;
+        std::vector<RenderPassId> dependencies;  // Explicit only; target edges are derived
+        bgfx::ViewId viewId = kNoView;
+
+        // Derived by linkResources()
+        std::vector<RenderPassId> readProducers;  // Writer of each read version; npos if none
+        std::vector<RenderPassId> producers;      // Passes whose output this one consumes
+        std::vector<RenderPassId> orderAfter;     // Ordering only: write-after-write/read
+    };
+
+    struct Target {
+        std::string name;
+        RenderTargetDesc desc;
+        uint16_t width = 0;   // Resolved at compile
+        uint16_t height = 0;
+        uint32_t physical = npos;
+    };
+
+    struct PhysicalTarget {
+        uint16_t width = 0;
+        uint16_t height = 0;
+        bgfx::TextureFormat::Enum format = bgfx::TextureFormat::BGRA8;
+        bool depth = false;
+        uint32_t lastUse = 0;  // Execution index of the last pass touching it
+        bgfx::FrameBufferHandle frameBuffer = BGFX_INVALID_HANDLE;
+    };
+
+    bgfx::ViewId firstViewId;
+    std::vector<Pass> passes;
+    std::vector<Target> targets;
+    std::vector<PhysicalTarget> physicalTargets;
+    std::vector<bgfx::FrameBufferHandle> retiredFrameBuffers;  // Destroyed on the next execute()
+    std::vector<RenderPassId> executionOrder;
+    uint16_t compiledWidth = 0;
+    uint16_t compiledHeight = 0;
+    bool compiled = false;
+
+    void linkResources();
+    bool sortPasses(std::vector<RenderPassId>& order) const;
+    std::vector<uint8_t> findLivePasses() const;
+    void assignPhysicalTargets();
+    void createFrameBuffers();
+};
+
+} // namespace Engine
@@ -0,0 +1,109 @@
+#include "render_pipeline.h"
+#include "rendering/renderer.h"
+#include "core/memory_tracker.h"
+#include "platform/logging.h"
+#include <chrono>
+
+namespace Engine {
+
+RenderPipeline::RenderPipeline(Renderer& renderer, RenderFn render, const RenderPipelineConfig& config)
+    : renderer(renderer), render(std::move(render)), pipelined(config.pipelined) {
+    if (pipelined) {
+        thread = std::thread([this] { renderLoop(); });
+    }
+}
+
+RenderPipeline::~RenderPipeline() {
+    flush();
+    if (thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+}
+
+void RenderPipeline::submitFrame() {
+    RenderPacket& packet = packets[simIndex];
+    packet.frame = frameCount++;
+
+    if (!pipelined) {
+        prepareFrame(packet);
+        bgfx::Encoder* encoder = bgfx::begin();
+        render(packet, encoder);
+        bgfx::end(encoder);
+        renderer.endFrame();
+        packet.queue.clear();
+        return;
+    }
+
+    // Encoders must be ended before bgfx::frame(), so present the previous
+    // packet only once the render thread is done with it.
+    waitIdle();
+    if (framePending) {
+        renderer.endFrame();
+    }
+
+    // View state is API-thread only; set it before handing the packet over.
+    prepareFrame(packet);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = &packet;
+    }
+    wake.notify_one();
+    framePending = true;
+
+    simIndex ^= 1;
+    packets[simIndex].queue.clear();  // Its render finished in waitIdle()
+}
+
+void RenderPipeline::flush() {
+    if (!pipelined) return;
+    waitIdle();
+    if (framePending) {
+        renderer.endFrame();
+        framePending = false;
+    }
+}
+
+void RenderPipeline::renderLoop() {
+    MemoryTagScope memoryTag(MemoryTag::Rendering);
+    for (;;) {
+        RenderPacket* packet = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return pending != nullptr || stopping; });
+            if (!pending) return;
+            packet = pending;
+        }
+
+        if (bgfx::Encoder* encoder = bgfx::begin(true)) {
+            render(*packet, encoder);
+            bgfx::end(encoder);
+        } else {
+            Log::error("RenderPipeline: no bgfx encoder available, frame {} dropped", packet->frame);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending = nullptr;
+        }
+        idle.notify_one();
+    }
+}
+
+void RenderPipeline::waitIdle() {
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return pending == nullptr; });
+    lastWaitMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void RenderPipeline::prepareFrame(const RenderPacket& packet) {
+    renderer.clear(packet.clearColor);
+    renderer.beginFrame();
+}
+
+} // namespace Engine
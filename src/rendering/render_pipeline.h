@@ -0,0 +1,85 @@
+#pragma once
+#include "core/types.h"
+#include "rendering/render_queue.h"
+#include <bgfx/bgfx.h>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Engine {
+
+class Renderer;
+
+// Everything the render thread needs for one frame. Simulation fills it;
+// the render thread owns it exclusively until it is handed back.
+struct RenderPacket {
+    RenderQueue queue;        // Sprites plus view/culling state
+    Mat4 viewProj{1.0f};
+    Color clearColor = Color::Black;
+    uint64_t frame = 0;
+};
+
+struct RenderPipelineConfig {
+    bool pipelined = true;  // false = build and present on the calling thread
+};
+
+// Pipelined simulation/rendering with two RenderPackets.
+// While the main thread simulates frame N+1 into one packet, a render
+// thread records frame N's draws from the other through its own bgfx
+// encoder. bgfx::frame() has to run on the API thread, so submitFrame()
+// waits for the previous packet and presents it (Renderer::endFrame)
+// before handing over the next one. That adds one frame of latency.
+//
+// Resources referenced by a packet must outlive it: destroy them only
+// after flush(), or defer destruction by a frame (see TextureRegistry).
+class RenderPipeline {
+public:
+    // Called on the render thread (or inline when not pipelined)
+    using RenderFn = std::function<void(RenderPacket& packet, bgfx::Encoder* encoder)>;
+
+    RenderPipeline(Renderer& renderer, RenderFn render, const RenderPipelineConfig& config = {});
+    ~RenderPipeline();
+
+    RenderPipeline(const RenderPipeline&) = delete;
+    RenderPipeline& operator=(const RenderPipeline&) = delete;
+
+    // Packet for the frame being simulated; never the one being rendered
+    RenderPacket& getSimulationPacket() { return packets[simIndex]; }
+
+    // Hands the simulation packet to the render thread; the next call to
+    // getSimulationPacket() returns the other, cleared packet.
+    void submitFrame();
+    // Waits for the in-flight packet and presents it
+    void flush();
+
+    bool isPipelined() const { return pipelined; }
+    uint64_t getFrameCount() const { return frameCount; }
+    // Time the last submitFrame() blocked on the render thread
+    float getLastWaitMs() const { return lastWaitMs; }
+
+private:
+    Renderer& renderer;
+    RenderFn render;
+    bool pipelined;
+
+    RenderPacket packets[2];
+    uint32_t simIndex = 0;
+    uint64_t frameCount = 0;
+    float lastWaitMs = 0.0f;
+    bool framePending = false;  // Recorded but not yet presented
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    RenderPacket* pending = nullptr;  // Guarded by mutex
+    bool stopping = false;
+
+    void renderLoop();
+    void waitIdle();
+    void prepareFrame(const RenderPacket& packet);
+};
+
+} // namespace Engine
@@ -1,9 +1,25 @@
 // src/rendering/render_queue.cpp
 #include "render_queue.h"
+#include "core/transform_batch.h"
+#include "rendering/camera.h"
 #include <algorithm>
+#include <cmath>
 
 namespace Engine {
 
+namespace {
+// Groups equal-depth items by shader variant first (a program switch costs
+// more than a texture bind), then by the textures they bind.
+uint64_t batchKey(const SpriteDrawData& sprite) {
+    const SpriteShaderFeature features = normalizeSpriteFeatures(sprite.features, bgfx::isValid(sprite.palette));
+    const bool solid = hasFeature(features, SpriteShaderFeature::Solid);
+    const uint16_t texture = solid ? bgfx::kInvalidHandle : sprite.texture.idx;
+    const uint16_t palette = hasFeature(features, SpriteShaderFeature::Palette) ? sprite.palette.idx : bgfx::kInvalidHandle;
+    return (static_cast<uint64_t>(getSpriteVariantIndex(features)) << 32) |
+           (static_cast<uint64_t>(texture) << 16) | palette;
+}
+} // namespace
+
 void RenderQueue::submit(const RenderItem& item) {
     items.push_back(item);
 }
@@ -22,56 +38,86 @@ void RenderQueue::clear() {
 }
 
 void RenderQueue::sort() {
-    // Painter's algorithm: higher depth (further away) draws first
+    // Painter's algorithm: higher depth (further away) draws first; equal
+    // depths keep batch-compatible sprites adjacent.
     std::sort(items.begin(), items.end(),
         [](const RenderItem& a, const RenderItem& b) {
-            return a.depth > b.depth;
+            if (a.depth != b.depth) {
+                return a.depth > b.depth;
+            }
+            return batchKey(a.sprite) < batchKey(b.sprite);
         });
 }
 
+void RenderQueue::setCamera(const Camera& camera) {
+    setViewTransform(camera.getViewMatrix());
+}
+
+void RenderQueue::setViewTransform(const Mat4& view) {
+    // 2D part of the view matrix (z and projection terms are not used here)
+    viewTransform.a = view[0][0];
+    viewTransform.b = view[0][1];
+    viewTransform.c = view[1][0];
+    viewTransform.d = view[1][1];
+    viewTransform.tx = view[3][0];
+    viewTransform.ty = view[3][1];
+}
+
 void RenderQueue::setCameraTransform(const Transform& camera) {
-    cameraTransform = camera;
+    viewTransform = Affine2D::translation(-camera.position);
 }
 
 void RenderQueue::setCullingBounds(const Rectangle& bounds) {
     cullingBounds = bounds;
 }
 
-bool RenderQueue::shouldCull(const RenderItem& item) const {
-    if (!cullingEnabled || cullingBounds.isEmpty()) {
-        return false;
-    }
+void RenderQueue::computeVisibility() {
+    const size_t count = items.size();
+    screenTransforms.resize(count);
+    localBounds.resize(count);
+    visible.assign(count, 1);
+    culledCount = 0;
 
-    // Use sprite bounds in screen space so camera offset is respected.
-    Rectangle bounds = buildSpriteBounds(item);
-    return !cullingBounds.intersects(bounds);
-}
+    for (size_t i = 0; i < count; ++i) {
+        const RenderItem& item = items[i];
+        screenTransforms[i] = viewTransform * item.transform.toAffine();
+        // Quad corners are (0,0)-(size) shifted by the origin, in local units.
+        localBounds[i] = Rectangle(-item.sprite.origin.x, -item.sprite.origin.y,
+                                   std::max(item.sprite.size.x, 0.0f), std::max(item.sprite.size.y, 0.0f));
+    }
 
-Vec2 RenderQueue::worldToScreen(const Vec2& worldPos) const {
-    // Basic camera offset subtraction
-    return worldPos - cameraTransform.position;
-}
+    if (!cullingEnabled || cullingBounds.isEmpty()) {
+        return;
+    }
 
-Rectangle RenderQueue::buildSpriteBounds(const RenderItem& item) const {
-    Vec2 screenPos = worldToScreen(item.transform.position);
-    Vec2 scaledSize = item.sprite.size * item.transform.scale;
+    screenBounds.resize(count);
+    computeWorldBounds(screenTransforms, localBounds, screenBounds);
 
-    if (scaledSize.x <= 0.0f || scaledSize.y <= 0.0f) {
-        // Degenerate sizes fall back to point culling.
-        return Rectangle(screenPos.x, screenPos.y, 0.0f, 0.0f);
+    // Inclusive overlap so zero-sized items still cull as points.
+    const float left = cullingBounds.left();
+    const float right = cullingBounds.right();
+    const float top = cullingBounds.top();
+    const float bottom = cullingBounds.bottom();
+    for (size_t i = 0; i < count; ++i) {
+        const Rectangle& b = screenBounds[i];
+        const bool inside = b.left() <= right && b.right() >= left &&
+                            b.top() <= bottom && b.bottom() >= top;
+        visible[i] = inside ? 1 : 0;
+        culledCount += inside ? 0 : 1;
     }
-
-    Vec2 origin = item.sprite.origin;
-    Vec2 topLeft = screenPos - origin;
-    return Rectangle(topLeft.x, topLeft.y, scaledSize.x, scaledSize.y);
 }
 
-SpriteDrawData RenderQueue::buildDrawData(const RenderItem& item) const {
+SpriteDrawData RenderQueue::buildDrawData(const RenderItem& item, const Affine2D& screen) const {
+    // SpriteDrawData has no shear, so a uniform view scale is assumed here.
+    const float viewScale = std::sqrt(viewTransform.a * viewTransform.a + viewTransform.b * viewTransform.b);
+    const float viewRotation = toDegrees(std::atan2(viewTransform.b, viewTransform.a));
+
     SpriteDrawData result = item.sprite;
-    result.position = worldToScreen(item.transform.position);
-    result.rotation = item.transform.rotation;
-    result.size = item.sprite.size * item.transform.scale;
+    result.position = screen.getTranslation();
+    result.rotation = item.transform.rotation + viewRotation;
+    result.size = item.sprite.size * item.transform.scale * viewScale;
+    result.origin = item.sprite.origin * item.transform.scale * viewScale;  // Origin is in local sprite units
     return result;
 }
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -1,12 +1,16 @@
 // src/rendering/render_queue.h
 #pragma once
+#include <utility>
 #include <vector>
+#include "core/affine2d.h"
 #include "core/transform.h"
 #include "math/rectangle.h"
 #include "rendering/sprite_batch.h"
 
 namespace Engine {
 
+class Camera;
+
 // Render item submitted to the queue
 struct RenderItem {
     float depth = 0.0f;                 // Z-order: higher = further back
@@ -31,13 +35,21 @@ public:
     void clear();
     void sort();  // Must call before render()
 
-    // Rendering (batch type must expose begin(viewProj), draw(sprite), end())
-    template <typename BatchT>
-    void render(BatchT& batch, const Mat4& viewProj);
+    // Rendering (batch type must expose begin(viewProj), draw(sprite), end()).
+    // Batches that also accept draw(sprite, Affine2D) get the item's
+    // transform as an affine and no per-item SpriteDrawData copy.
+    // Extra arguments are forwarded to begin() (e.g. view id and encoder).
+    template <typename BatchT, typename... BeginArgs>
+    void render(BatchT& batch, const Mat4& viewProj, BeginArgs&&... beginArgs);
     
-    // Camera integration (optional)
-    void setCameraTransform(const Transform& camera);
-    void setCullingBounds(const Rectangle& bounds);
+    // Camera integration (optional). The view transform maps world to
+    // screen space; culling and drawing both go through it.
+    void setCamera(const Camera& camera);              // Uses Camera::getViewMatrix()
+    void setViewTransform(const Mat4& view);
+    void setViewTransform(const Affine2D& view) { viewTransform = view; }
+    void setCameraTransform(const Transform& camera);  // Translation only
+    const Affine2D& getViewTransform() const { return viewTransform; }
+    void setCullingBounds(const Rectangle& bounds);    // Screen space
     void enableCulling(bool enabled) { cullingEnabled = enabled; }
     
     // Queries
@@ -50,30 +62,38 @@ public:
     
 private:
     std::vector<RenderItem> items;
-    Transform cameraTransform;
+    Affine2D viewTransform;
     Rectangle cullingBounds;
     bool cullingEnabled = false;
     size_t culledCount = 0;
-    
-    bool shouldCull(const RenderItem& item) const;
-    Vec2 worldToScreen(const Vec2& worldPos) const;
-    Rectangle buildSpriteBounds(const RenderItem& item) const;
-    SpriteDrawData buildDrawData(const RenderItem& item) const;
+
+    // Per-frame scratch, parallel to items
+    std::vector<Affine2D> screenTransforms;
+    std::vector<Rectangle> localBounds;
+    std::vector<Rectangle> screenBounds;
+    std::vector<uint8_t> visible;
+
+    // Screen transforms and rotation-aware bounds for all items in one pass
+    void computeVisibility();
+    SpriteDrawData buildDrawData(const RenderItem& item, const Affine2D& screen) const;
 };
 
-template <typename BatchT>
-void RenderQueue::render(BatchT& batch, const Mat4& viewProj) {
-    culledCount = 0;
-    batch.begin(viewProj);
+template <typename BatchT, typename... BeginArgs>
+void RenderQueue::render(BatchT& batch, const Mat4& viewProj, BeginArgs&&... beginArgs) {
+    computeVisibility();
+    batch.begin(viewProj, std::forward<BeginArgs>(beginArgs)...);
     
-    for (const auto& item : items) {
-        if (shouldCull(item)) {
-            ++culledCount;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (!visible[i]) {
             continue;
         }
         
-        SpriteDrawData drawData = buildDrawData(item);
-        batch.draw(drawData);
+        const RenderItem& item = items[i];
+        if constexpr (requires { batch.draw(item.sprite, Affine2D{}); }) {
+            batch.draw(item.sprite, screenTransforms[i]);
+        } else {
+            batch.draw(buildDrawData(item, screenTransforms[i]));
+        }
     }
     
     batch.end();
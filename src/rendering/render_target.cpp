@@ -0,0 +1,125 @@
+#include "render_target.h"
+#include "platform/logging.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+uint16_t scaledDimension(int size, float scale) {
+    return static_cast<uint16_t>(std::max(1.0f, static_cast<float>(size) * scale));
+}
+} // namespace
+
+RenderTarget::~RenderTarget() {
+    destroy();
+}
+
+bool RenderTarget::create(uint16_t w, uint16_t h, const RenderTargetConfig& cfg) {
+    destroy();
+    config = cfg;
+    return createFrameBuffer(w, h);
+}
+
+bool RenderTarget::create(Window& target, const RenderTargetConfig& cfg) {
+    destroy();
+    config = cfg;
+    const uint16_t w = cfg.width ? cfg.width : scaledDimension(target.getWidth(), cfg.scale);
+    const uint16_t h = cfg.height ? cfg.height : scaledDimension(target.getHeight(), cfg.scale);
+    if (!createFrameBuffer(w, h)) {
+        return false;
+    }
+
+    if (cfg.width == 0 || cfg.height == 0) {
+        window = &target;
+        resizeListener = target.addResizeListener([this](int newWidth, int newHeight) {
+            onWindowResized(newWidth, newHeight);
+        });
+    }
+    return true;
+}
+
+void RenderTarget::destroy() {
+    if (window) {
+        window->removeResizeListener(resizeListener);
+        window = nullptr;
+        resizeListener = 0;
+    }
+    if (bgfx::isValid(frameBuffer)) {
+        bgfx::destroy(frameBuffer);  // Also destroys the attachments
+        frameBuffer = BGFX_INVALID_HANDLE;
+    }
+    width = 0;
+    height = 0;
+}
+
+bool RenderTarget::resize(uint16_t w, uint16_t h) {
+    if (w == width && h == height && isValid()) {
+        return true;
+    }
+    if (bgfx::isValid(frameBuffer)) {
+        bgfx::destroy(frameBuffer);
+        frameBuffer = BGFX_INVALID_HANDLE;
+    }
+    return createFrameBuffer(w, h);
+}
+
+bool RenderTarget::createFrameBuffer(uint16_t w, uint16_t h) {
+    if (w == 0 || h == 0) {
+        Log::error("RenderTarget: invalid size {}x{}", w, h);
+        return false;
+    }
+
+    uint64_t flags = BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
+    if (config.pointFilter) {
+        flags |= BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT;
+    }
+
+    if (config.depth) {
+        bgfx::TextureHandle attachments[2] = {
+            bgfx::createTexture2D(w, h, false, 1, config.format, flags),
+            bgfx::createTexture2D(w, h, false, 1, bgfx::TextureFormat::D24S8, BGFX_TEXTURE_RT),
+        };
+        frameBuffer = bgfx::createFrameBuffer(2, attachments, true);
+    } else {
+        frameBuffer = bgfx::createFrameBuffer(w, h, config.format, flags);
+    }
+
+    if (!bgfx::isValid(frameBuffer)) {
+        Log::error("RenderTarget: failed to create {}x{} framebuffer", w, h);
+        return false;
+    }
+
+    width = w;
+    height = h;
+    ++generation;
+    return true;
+}
+
+void RenderTarget::onWindowResized(int newWidth, int newHeight) {
+    if (newWidth <= 0 || newHeight <= 0) return;  // Minimized
+    const uint16_t w = config.width ? config.width : scaledDimension(newWidth, config.scale);
+    const uint16_t h = config.height ? config.height : scaledDimension(newHeight, config.scale);
+    resize(w, h);
+}
+
+void RenderTarget::bindToView(bgfx::ViewId view) const {
+    bgfx::setViewFrameBuffer(view, frameBuffer);
+    bgfx::setViewRect(view, 0, 0, width, height);
+}
+
+bgfx::TextureHandle RenderTarget::getTexture() const {
+    if (!isValid()) {
+        return BGFX_INVALID_HANDLE;
+    }
+    return bgfx::getTexture(frameBuffer);
+}
+
+Vec4 RenderTarget::getUvRect() const {
+    const bgfx::Caps* caps = bgfx::getCaps();
+    if (caps && caps->originBottomLeft) {
+        return Vec4(0.0f, 1.0f, 1.0f, -1.0f);
+    }
+    return Vec4(0.0f, 0.0f, 1.0f, 1.0f);
+}
+
+} // namespace Engine
@@ -0,0 +1,61 @@
+#pragma once
+#include "math/vector.h"
+#include "platform/window.h"
+#include <bgfx/bgfx.h>
+#include <cstdint>
+
+namespace Engine {
+
+struct RenderTargetConfig {
+    uint16_t width = 0;    // 0 = follow the window (times scale)
+    uint16_t height = 0;
+    float scale = 1.0f;    // Window-relative size multiplier
+    bgfx::TextureFormat::Enum format = bgfx::TextureFormat::BGRA8;
+    bool depth = false;    // Adds a D24S8 attachment
+    bool pointFilter = false;
+};
+
+// Offscreen framebuffer whose color attachment can be sampled as a texture.
+// Window-relative targets are recreated from the window's resize event; the
+// window must outlive the target.
+class RenderTarget {
+public:
+    RenderTarget() = default;
+    ~RenderTarget();
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    bool create(uint16_t width, uint16_t height, const RenderTargetConfig& config = RenderTargetConfig{});
+    bool create(Window& window, const RenderTargetConfig& config = RenderTargetConfig{});
+    void destroy();
+    bool resize(uint16_t width, uint16_t height);
+
+    // Points `view` at this target with a full-size viewport
+    void bindToView(bgfx::ViewId view) const;
+
+    bool isValid() const { return bgfx::isValid(frameBuffer); }
+    bgfx::FrameBufferHandle getFrameBuffer() const { return frameBuffer; }
+    bgfx::TextureHandle getTexture() const;
+    uint16_t getWidth() const { return width; }
+    uint16_t getHeight() const { return height; }
+    Vec2 getSize() const { return Vec2(width, height); }
+    // UVs for sampling the whole target (flipped on bottom-left-origin backends)
+    Vec4 getUvRect() const;
+    // Bumped whenever the framebuffer is recreated; contents are lost then
+    uint32_t getGeneration() const { return generation; }
+
+private:
+    bgfx::FrameBufferHandle frameBuffer = BGFX_INVALID_HANDLE;
+    RenderTargetConfig config;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    uint32_t generation = 0;
+    Window* window = nullptr;
+    Window::ResizeListenerId resizeListener = 0;
+
+    bool createFrameBuffer(uint16_t width, uint16_t height);
+    void onWindowResized(int width, int height);
+};
+
+} // namespace Engine
@@ -1,6 +1,9 @@
 #include "renderer.h"
+#include "shader_library.h"
+#include "core/memory_tracker.h"
 #include "platform/logging.h"
 #include <GLFW/glfw3.h>
+#include <chrono>
 #if defined(__linux__) && !defined(__APPLE__)
 #define GLFW_EXPOSE_NATIVE_X11
 #define GLFW_EXPOSE_NATIVE_WAYLAND
@@ -55,7 +58,10 @@ static bgfx::RendererType::Enum toBgfxBackend(RendererBackend backend) {
 }
 
 Renderer::Renderer(Window* window, const RendererConfig& config)
-    : window(window), debugEnabled(config.debug) {
+    : window(window),
+      debugEnabled(config.debug),
+      profilingEnabled(config.profiling),
+      frameAllocator(config.frameArenaBytes) {
     bgfx::PlatformData pd{};
 #ifdef _WIN32
     pd.nwh = window->getNativeWindowHandle();
@@ -103,18 +109,21 @@ Renderer::Renderer(Window* window, const RendererConfig& config)
     Log::info("BGFX initialized: {}", bgfx::getRendererName(bgfx::getRendererType()));
 
     resetFlags = config.vsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE;
-    if (debugEnabled) {
-        bgfx::setDebug(BGFX_DEBUG_TEXT | BGFX_DEBUG_STATS);
-    }
+    applyDebugFlags();
 
     bgfx::setViewClear(0, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, Color::Black.toUint32(), 1.0f, 0);
     bgfx::setViewRect(0, 0, 0, window->getWidth(), window->getHeight());
 
     window->setResizeCallback([this](int w, int h) { resize(w, h); });
+
+    if (!ShaderLibrary::instance().preload({kBuiltinShaderPrograms, kBuiltinShaderProgramCount})) {
+        Log::error("Failed to preload built-in shader programs");
+    }
 }
 
 Renderer::~Renderer() {
     if (initialized) {
+        ShaderLibrary::instance().clear();
         bgfx::shutdown();
         Log::info("BGFX shutdown");
     }
@@ -122,12 +131,94 @@ Renderer::~Renderer() {
 
 void Renderer::beginFrame() {
     if (!initialized) return;
+    MemoryTagScope memoryTag(MemoryTag::Rendering);
+    frameAllocator.beginFrame();
     bgfx::touch(0);
 }
 
 void Renderer::endFrame() {
     if (!initialized) return;
+    MemoryTagScope memoryTag(MemoryTag::Rendering);
+    if (profilerOverlay) {
+        drawProfilerOverlay();
+    }
+
+    const auto submitStart = std::chrono::steady_clock::now();
     bgfx::frame();
+    const std::chrono::duration<float, std::milli> submitTime = std::chrono::steady_clock::now() - submitStart;
+
+    // Stats describe the frame that was just kicked (GPU times lag behind).
+    FrameTimings timings = FrameTimings::fromStats(*bgfx::getStats());
+    timings.frameCallMs = submitTime.count();
+    profiler.addFrame(timings);
+}
+
+void Renderer::setProfilerOverlay(bool enabled) {
+    if (enabled == profilerOverlay) return;
+    profilerOverlay = enabled;
+    if (initialized) {
+        applyDebugFlags();
+    }
+}
+
+void Renderer::applyDebugFlags() {
+    uint32_t flags = BGFX_DEBUG_NONE;
+    if (debugEnabled) {
+        flags |= BGFX_DEBUG_TEXT | BGFX_DEBUG_STATS;
+    }
+    if (profilingEnabled) {
+        flags |= BGFX_DEBUG_PROFILER;
+    }
+    if (profilerOverlay) {
+        // Both overlays draw at the top left; ours wins.
+        flags = (flags & ~BGFX_DEBUG_STATS) | BGFX_DEBUG_TEXT;
+    }
+    bgfx::setDebug(flags);
+}
+
+void Renderer::drawProfilerOverlay() {
+    bgfx::dbgTextClear();
+
+    constexpr uint8_t kHeader = 0x0f;
+    constexpr uint8_t kText = 0x07;
+    constexpr uint8_t kWarning = 0x0c;
+    uint16_t row = 1;
+    bgfx::dbgTextPrintf(1, row++, kHeader, "%s  %s", getBackendName(), toString(profiler.getBound()));
+    auto line = [&](const char* label, const RollingHistory& history) {
+        bgfx::dbgTextPrintf(1, row++, kText, "%-12s %6.2f ms  avg %6.2f  max %6.2f",
+                            label, history.latest(), history.average(), history.max());
+    };
+    line("Frame", profiler.getFrameHistory());
+    line("CPU (main)", profiler.getCpuHistory());
+    line("GPU", profiler.getGpuHistory());
+    line("Submit", profiler.getSubmitHistory());
+    line("Wait render", profiler.getWaitRenderHistory());
+
+    if (!profiler.getViews().empty()) {
+        ++row;
+        bgfx::dbgTextPrintf(1, row++, kHeader, "%-4s %-20s %8s %8s", "View", "Name", "CPU ms", "GPU ms");
+        for (const FrameProfiler::ViewHistory& view : profiler.getViews()) {
+            bgfx::dbgTextPrintf(1, row++, kText, "%-4u %-20.20s %8.2f %8.2f",
+                                static_cast<unsigned>(view.view), view.name.c_str(),
+                                view.cpu.average(), view.gpu.average());
+        }
+    }
+
+    // Per-subsystem heap use needs the operator new hooks
+    if (!MemoryTracker::isHooked()) return;
+    const MemoryTracker& memory = MemoryTracker::get();
+    ++row;
+    bgfx::dbgTextPrintf(1, row++, kHeader, "%-10s %10s %10s %8s %10s", "Memory", "Live KB", "Peak KB", "Allocs/f",
+                        "Budget KB");
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        const MemoryTagStats stats = memory.getStats(tag);
+        bgfx::dbgTextPrintf(1, row++, stats.overBudget ? kWarning : kText, "%-10s %10lld %10lld %8llu %10llu",
+                            toString(tag), static_cast<long long>(stats.liveBytes / 1024),
+                            static_cast<long long>(stats.peakBytes / 1024),
+                            static_cast<unsigned long long>(stats.frameAllocations),
+                            static_cast<unsigned long long>(stats.budgetBytes / 1024));
+    }
 }
 
 void Renderer::clear(const Color& color) {
@@ -2,6 +2,8 @@
 #include "math/vector.h"
 #include "core/types.h"
 #include "platform/window.h"
+#include "core/frame_allocator.h"
+#include "frame_profiler.h"
 #include <bgfx/bgfx.h>
 #include <bgfx/platform.h>
 
@@ -19,6 +21,8 @@ struct RendererConfig {
     RendererBackend backend = RendererBackend::Auto;
     bool vsync = true;
     bool debug = false;
+    bool profiling = false;  // Per-view GPU timer queries (BGFX_DEBUG_PROFILER)
+    size_t frameArenaBytes = 1024 * 1024;  // Per buffer; grows to the peak frame
 };
 
 class Renderer {
@@ -37,13 +41,29 @@ public:
     int height() const { return window->getHeight(); }
     bool isInitialized() const { return initialized; }
 
+    // Timings are collected every frame; per-view GPU times need config.profiling
+    const FrameProfiler& getProfiler() const { return profiler; }
+
+    // Transient per-frame memory, reset by beginFrame(); allocations stay
+    // valid through the following frame
+    FrameAllocator& getFrameAllocator() { return frameAllocator; }
+    // Debug-text overlay with frame/view timings (replaces the bgfx stats overlay)
+    void setProfilerOverlay(bool enabled);
+    bool isProfilerOverlayEnabled() const { return profilerOverlay; }
+
 private:
     Window* window;
     bool debugEnabled;
+    bool profilingEnabled;
+    bool profilerOverlay = false;
     uint16_t resetFlags;
     bool initialized = false;
+    FrameProfiler profiler;
+    FrameAllocator frameAllocator;
 
     void resize(int width, int height);
+    void applyDebugFlags();
+    void drawProfilerOverlay();
 };
 
 } // namespace Engine
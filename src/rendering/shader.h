@@ -4,21 +4,24 @@
 
 namespace Engine {
 
+// Reference to a program shared through ShaderLibrary; loading the same
+// pair twice reuses the compiled program.
 class Shader {
 public:
     Shader() = default;
     ~Shader();
 
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
+
     bool load(const std::string& vertexBaseName, const std::string& fragmentBaseName);
-    bgfx::ProgramHandle getProgram() const { return program; }
-    bool isValid() const { return bgfx::isValid(program); }
+    // Current program; changes when ShaderHotReload swaps it between frames
+    bgfx::ProgramHandle getProgram() const;
+    bool isValid() const { return bgfx::isValid(getProgram()); }
     void destroy();
 
 private:
-    bgfx::ProgramHandle program = BGFX_INVALID_HANDLE;
-
-    bgfx::ShaderHandle loadShader(const std::string& baseName);
-    std::string selectShaderPath(const std::string& baseName);
+    const bgfx::ProgramHandle* program = nullptr;  // Slot owned by ShaderLibrary
 };
 
 } // namespace Engine
@@ -0,0 +1,246 @@
+#include "shader_hot_reload.h"
+#include "shader_library.h"
+#include "sprite_shader_variants.h"
+#include "platform/file_system.h"
+#include "platform/logging.h"
+#include <bgfx/bgfx.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+constexpr int kPollTimeoutMs = 100;
+constexpr auto kDebounce = std::chrono::milliseconds(50);  // Editors save in bursts
+
+bool endsWith(const std::string& value, const std::string& suffix) {
+    return value.size() >= suffix.size() &&
+           value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool isProgramSource(const std::string& name) {
+    return endsWith(name, ".vert.sc") || endsWith(name, ".frag.sc");
+}
+
+std::string shellQuote(const std::string& value) {
+    std::string quoted = "'";
+    for (char c : value) {
+        if (c == '\'') {
+            quoted += "'\\''";
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "'";
+}
+
+} // namespace
+
+ShaderHotReloadConfig ShaderHotReload::defaultConfig() {
+    ShaderHotReloadConfig config;
+#ifdef ENGINE_SHADER_HOT_RELOAD
+    config.sourceDir = ENGINE_SHADER_SRC_DIR;
+    config.shadercPath = ENGINE_SHADERC_PATH;
+    config.includeDir = ENGINE_SHADERC_INCLUDE_DIR;
+    config.platform = ENGINE_SHADERC_PLATFORM;
+#endif
+    return config;
+}
+
+bool ShaderHotReload::start(const ShaderHotReloadConfig& newConfig) {
+    stop();
+    config = newConfig;
+    if (config.varyingDef.empty()) {
+        config.varyingDef = FileSystem::combinePath(config.sourceDir, "varying.def.sc");
+    }
+    if (config.sourceDir.empty() || !FileSystem::fileExists(config.shadercPath)) {
+        Log::warn("Shader hot reload disabled: shaderc or shader sources not configured");
+        return false;
+    }
+
+    // Same profiles as the compile_shaders target.
+    switch (bgfx::getRendererType()) {
+        case bgfx::RendererType::Vulkan: vertexProfile = fragmentProfile = "spirv"; break;
+        case bgfx::RendererType::Metal: vertexProfile = fragmentProfile = "metal"; break;
+        case bgfx::RendererType::Direct3D11:
+        case bgfx::RendererType::Direct3D12: vertexProfile = "vs_5_0"; fragmentProfile = "ps_5_0"; break;
+        default: vertexProfile = fragmentProfile = "120"; break;
+    }
+
+#ifdef __linux__
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0 ||
+        inotify_add_watch(inotifyFd, config.sourceDir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        Log::error("Shader hot reload: cannot watch {}", config.sourceDir);
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+        return false;
+    }
+
+    running = true;
+    worker = std::thread([this] { watchLoop(); });
+    Log::info("Shader hot reload watching {}", config.sourceDir);
+    return true;
+#else
+    Log::warn("Shader hot reload is only available on Linux");
+    return false;
+#endif
+}
+
+void ShaderHotReload::stop() {
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+        inotifyFd = -1;
+    }
+#endif
+    std::lock_guard<std::mutex> lock(readyMutex);
+    ready.clear();
+}
+
+void ShaderHotReload::update(const std::function<void()>& beforeApply) {
+    std::vector<CompiledShader> compiled;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        compiled.swap(ready);
+    }
+    // Compiles finishing after the swap wait for the next update().
+    if (compiled.empty()) return;
+    if (beforeApply) {
+        beforeApply();
+    }
+    for (const CompiledShader& shader : compiled) {
+        if (ShaderLibrary::instance().reloadShader(shader.baseName, shader.binary)) {
+            ++reloadCount;
+        }
+    }
+}
+
+void ShaderHotReload::watchLoop() {
+#ifdef __linux__
+    while (running) {
+        pollfd pfd{inotifyFd, POLLIN, 0};
+        if (poll(&pfd, 1, kPollTimeoutMs) <= 0) continue;
+
+        std::vector<std::string> changed;
+        bool sharedChanged = readEvents(changed);
+        std::this_thread::sleep_for(kDebounce);
+        sharedChanged |= readEvents(changed);
+
+        if (sharedChanged) {
+            changed = listShaderSources();
+        }
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+        for (const std::string& name : changed) {
+            if (!running) break;
+            if (name == "sprite.frag.sc") {
+                // Every sprite variant is built from this source.
+                for (uint32_t i = 0; i < kSpriteShaderVariantCount && running; ++i) {
+                    compile(name, getSpriteFragmentName(i), getSpriteVariantDefines(i));
+                }
+            } else {
+                compile(name, name.substr(0, name.size() - 3), "");  // Strip ".sc"
+            }
+        }
+    }
+#endif
+}
+
+bool ShaderHotReload::readEvents(std::vector<std::string>& changed) {
+    // Returns true when a non-program file (varying.def.sc, includes) changed.
+    bool sharedChanged = false;
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+        for (char* p = buffer; p < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(p);
+            p += sizeof(inotify_event) + event->len;
+            if (event->len == 0) continue;
+
+            const std::string name = event->name;
+            if (isProgramSource(name)) {
+                changed.push_back(name);
+            } else if (endsWith(name, ".sc") || endsWith(name, ".sh")) {
+                sharedChanged = true;
+            }
+        }
+    }
+#endif
+    return sharedChanged;
+}
+
+std::vector<std::string> ShaderHotReload::listShaderSources() const {
+    std::vector<std::string> names;
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(config.sourceDir, ec)) {
+        const std::string name = file.path().filename().string();
+        if (isProgramSource(name)) {
+            names.push_back(name);
+        }
+    }
+    return names;
+}
+
+void ShaderHotReload::compile(const std::string& sourceFile, const std::string& baseName,
+                              const std::string& defines) {
+    const bool vertex = endsWith(baseName, ".vert");
+    const std::string output =
+        (std::filesystem::temp_directory_path() / ("engine_hot_" + baseName + ".bin")).string();
+
+    const std::string command = shellQuote(config.shadercPath) +
+        " -f " + shellQuote(FileSystem::combinePath(config.sourceDir, sourceFile)) +
+        " -o " + shellQuote(output) +
+        " --platform " + config.platform +
+        " --type " + (vertex ? "vertex" : "fragment") +
+        " -p " + (vertex ? vertexProfile : fragmentProfile) +
+        " -i " + shellQuote(config.includeDir) +
+        " --varyingdef " + shellQuote(config.varyingDef) +
+        (defines.empty() ? "" : " --define " + shellQuote(defines)) + " 2>&1";
+
+    std::string log;
+    int status = -1;
+#ifdef __linux__
+    if (FILE* pipe = popen(command.c_str(), "r")) {
+        char line[512];
+        while (fgets(line, sizeof(line), pipe)) {
+            log += line;
+        }
+        status = pclose(pipe);
+    }
+#endif
+    if (status != 0) {
+        Log::error("Shader compile failed: {}\n{}", baseName, log);
+        return;
+    }
+
+    auto binary = FileSystem::loadBinaryFile(output);
+    std::error_code ec;
+    std::filesystem::remove(output, ec);
+    if (!binary) {
+        Log::error("Shader compile produced no output: {}", baseName);
+        return;
+    }
+
+    Log::info("Shader recompiled: {}", baseName);
+    std::lock_guard<std::mutex> lock(readyMutex);
+    ready.push_back({baseName, std::move(*binary)});
+}
+
+} // namespace Engine
@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+struct ShaderHotReloadConfig {
+    std::string sourceDir;    // Watched directory with *.vert.sc / *.frag.sc
+    std::string shadercPath;  // bgfx shaderc executable
+    std::string includeDir;   // Directory containing bgfx_shader.sh
+    std::string platform = "linux";
+    std::string varyingDef;   // Empty = <sourceDir>/varying.def.sc
+};
+
+// Development-time shader reloading (Linux, inotify).
+// A worker thread watches the shader sources, recompiles changed files with
+// shaderc for the running backend and queues the binaries; update() hands
+// them to ShaderLibrary at a frame boundary, so compiling never blocks the
+// render loop and every Shader switches to the new program on the same
+// frame. Failed compiles are logged and the old program stays active.
+// Editing a shared file (varying.def.sc, *.sh) recompiles every shader;
+// editing sprite.frag.sc recompiles all of its variants.
+class ShaderHotReload {
+public:
+    ShaderHotReload() = default;
+    ~ShaderHotReload() { stop(); }
+
+    ShaderHotReload(const ShaderHotReload&) = delete;
+    ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+
+    // Paths baked in by the ENGINE_SHADER_HOT_RELOAD CMake option
+    static ShaderHotReloadConfig defaultConfig();
+
+    // Call after the renderer is initialized (the backend picks the profile)
+    bool start(const ShaderHotReloadConfig& config);
+    void stop();
+    bool isRunning() const { return running.load(); }
+
+    // Once per frame, before any submits: applies finished compiles.
+    // beforeApply runs only when there is something to swap, right before
+    // the old programs are destroyed (e.g. to wait for a render thread).
+    void update(const std::function<void()>& beforeApply = {});
+
+    uint32_t getReloadCount() const { return reloadCount; }
+
+private:
+    struct CompiledShader {
+        std::string baseName;  // e.g. "sprite.frag"
+        std::vector<uint8_t> binary;
+    };
+
+    ShaderHotReloadConfig config;
+    std::string vertexProfile;
+    std::string fragmentProfile;
+    int inotifyFd = -1;
+    std::thread worker;
+    std::atomic<bool> running{false};
+
+    std::mutex readyMutex;
+    std::vector<CompiledShader> ready;
+    uint32_t reloadCount = 0;
+
+    void watchLoop();
+    bool readEvents(std::vector<std::string>& changed);
+    std::vector<std::string> listShaderSources() const;
+    void compile(const std::string& sourceFile, const std::string& baseName, const std::string& defines);
+};
+
+} // namespace Engine
@@ -0,0 +1,264 @@
+#include "shader_library.h"
+#include "platform/file_system.h"
+#include "platform/logging.h"
+#include "platform/platform.h"
+#include <future>
+#include <iterator>
+#include <optional>
+
+namespace Engine {
+
+const ShaderProgramDesc kBuiltinShaderPrograms[] = {
+    {"sprite.vert", "sprite.frag"},
+};
+const size_t kBuiltinShaderProgramCount = std::size(kBuiltinShaderPrograms);
+
+namespace {
+const char* binarySuffix(bgfx::RendererType::Enum backend) {
+    switch (backend) {
+        case bgfx::RendererType::OpenGL:
+        case bgfx::RendererType::OpenGLES: return ".gl.bin";
+        case bgfx::RendererType::Vulkan: return ".vk.bin";
+        case bgfx::RendererType::Metal: return ".mtl.bin";
+        case bgfx::RendererType::Direct3D11:
+        case bgfx::RendererType::Direct3D12: return ".dx11.bin";
+        default: return ".gl.bin";
+    }
+}
+} // namespace
+
+ShaderLibrary& ShaderLibrary::instance() {
+    static ShaderLibrary library;
+    return library;
+}
+
+bool ShaderLibrary::preload(std::span<const ShaderProgramDesc> descs) {
+    // Gather binaries not loaded yet and read them all at once.
+    std::unordered_map<std::string, std::future<std::optional<std::vector<uint8_t>>>> reads;
+    for (const ShaderProgramDesc& desc : descs) {
+        for (const std::string* name : {&desc.vertex, &desc.fragment}) {
+            std::string path = resolvePath(*name);
+            if (shaders.count(path) == 0 && reads.count(path) == 0) {
+                reads.emplace(path, std::async(std::launch::async, &FileSystem::loadBinaryFile, path));
+            }
+        }
+    }
+
+    std::unordered_map<std::string, std::vector<uint8_t>> binaries;
+    for (auto& [path, read] : reads) {
+        if (auto data = read.get()) {
+            binaries.emplace(path, std::move(*data));
+        }
+    }
+
+    bool ok = true;
+    for (const ShaderProgramDesc& desc : descs) {
+        ProgramEntry* entry = findOrLink(desc.vertex, desc.fragment, &binaries);
+        if (entry) {
+            entry->pinned = true;
+        } else {
+            ok = false;
+        }
+    }
+    Log::info("ShaderLibrary preloaded {} programs ({} binaries read)", descs.size(), reads.size());
+    return ok;
+}
+
+const bgfx::ProgramHandle* ShaderLibrary::acquire(const std::string& vertex, const std::string& fragment) {
+    ProgramEntry* entry = findOrLink(vertex, fragment, nullptr);
+    if (!entry) {
+        return nullptr;
+    }
+    ++entry->refs;
+    return &entry->handle;
+}
+
+void ShaderLibrary::release(const bgfx::ProgramHandle* program) {
+    ProgramEntry* entry = findEntry(program);
+    if (!entry) return;
+    if (entry->refs > 0) {
+        --entry->refs;
+    }
+    if (entry->refs > 0 || entry->pinned) return;
+
+    if (bgfx::isValid(entry->handle)) {
+        bgfx::destroy(entry->handle);
+        releaseShader(entry->vertexKey);
+        releaseShader(entry->fragmentKey);
+    }
+    const std::string key = entry->vertexKey + '|' + entry->fragmentKey;
+    programs.erase(key);
+}
+
+bool ShaderLibrary::reloadShader(const std::string& baseName, const std::vector<uint8_t>& data) {
+    const std::string key = resolvePath(baseName);
+    auto shaderIt = shaders.find(key);
+    if (shaderIt == shaders.end()) {
+        return false;  // Not in use; the next load reads the file anyway
+    }
+
+    const bgfx::ShaderHandle replacement = bgfx::createShader(bgfx::copy(data.data(), static_cast<uint32_t>(data.size())));
+    if (!bgfx::isValid(replacement)) {
+        Log::error("Shader reload failed to create {}", baseName);
+        return false;
+    }
+
+    // Link everything first so a failure leaves the old programs untouched.
+    std::vector<std::pair<ProgramEntry*, bgfx::ProgramHandle>> relinked;
+    for (auto& [programKey, entry] : programs) {
+        if (entry.vertexKey != key && entry.fragmentKey != key) continue;
+        const bgfx::ShaderHandle vsh = entry.vertexKey == key ? replacement : shaders[entry.vertexKey].handle;
+        const bgfx::ShaderHandle fsh = entry.fragmentKey == key ? replacement : shaders[entry.fragmentKey].handle;
+        const bgfx::ProgramHandle program = bgfx::createProgram(vsh, fsh, false);
+        if (!bgfx::isValid(program)) {
+            Log::error("Shader reload failed to link {}", programKey);
+            for (auto& [linked, handle] : relinked) {
+                bgfx::destroy(handle);
+            }
+            bgfx::destroy(replacement);
+            return false;
+        }
+        relinked.emplace_back(&entry, program);
+    }
+
+    // bgfx defers these destroys until the frame using them has rendered.
+    for (auto& [entry, program] : relinked) {
+        bgfx::destroy(entry->handle);
+        entry->handle = program;
+    }
+    bgfx::destroy(shaderIt->second.handle);
+    shaderIt->second.handle = replacement;
+    Log::info("Shader reloaded: {} ({} programs)", baseName, relinked.size());
+    return true;
+}
+
+void ShaderLibrary::clear() {
+    // Referenced entries stay (with invalid handles) so their slots remain
+    // valid until the owning Shader releases them.
+    for (auto it = programs.begin(); it != programs.end();) {
+        if (bgfx::isValid(it->second.handle)) {
+            bgfx::destroy(it->second.handle);
+            it->second.handle = BGFX_INVALID_HANDLE;
+        }
+        it = it->second.refs > 0 ? std::next(it) : programs.erase(it);
+    }
+    for (auto& [key, entry] : shaders) {
+        bgfx::destroy(entry.handle);
+    }
+    shaders.clear();
+    pathBackend = bgfx::RendererType::Count;
+}
+
+uint32_t ShaderLibrary::getRefCount(const bgfx::ProgramHandle* program) const {
+    for (const auto& [key, entry] : programs) {
+        if (&entry.handle == program) return entry.refs;
+    }
+    return 0;
+}
+
+ShaderLibrary::ProgramEntry* ShaderLibrary::findEntry(const bgfx::ProgramHandle* program) {
+    // Only a handful of programs exist; a scan beats keeping a reverse index.
+    if (!program) return nullptr;
+    for (auto& [key, entry] : programs) {
+        if (&entry.handle == program) return &entry;
+    }
+    return nullptr;
+}
+
+std::string ShaderLibrary::resolvePath(const std::string& baseName) {
+    // The prefix and suffix only change with the backend; cache them.
+    const bgfx::RendererType::Enum backend = bgfx::getRendererType();
+    if (backend != pathBackend) {
+        pathBackend = backend;
+        pathPrefix = Platform::getResourcePath("shaders/");
+        pathSuffix = binarySuffix(backend);
+    }
+    return pathPrefix + baseName + pathSuffix;
+}
+
+bgfx::ShaderHandle ShaderLibrary::createShader(const std::string& path, const std::vector<uint8_t>* data) {
+    auto it = shaders.find(path);
+    if (it != shaders.end()) {
+        return it->second.handle;
+    }
+
+    std::optional<std::vector<uint8_t>> loaded;
+    if (!data) {
+        loaded = FileSystem::loadBinaryFile(path);
+        data = loaded ? &*loaded : nullptr;
+    }
+    if (!data) {
+        Log::error("Failed to load shader binary: {}", path);
+        return BGFX_INVALID_HANDLE;
+    }
+
+    const bgfx::Memory* mem = bgfx::copy(data->data(), static_cast<uint32_t>(data->size()));
+    bgfx::ShaderHandle handle = bgfx::createShader(mem);
+    if (bgfx::isValid(handle)) {
+        shaders.emplace(path, ShaderEntry{handle, 0});
+    }
+    return handle;
+}
+
+ShaderLibrary::ProgramEntry* ShaderLibrary::findOrLink(
+    const std::string& vertex, const std::string& fragment,
+    const std::unordered_map<std::string, std::vector<uint8_t>>* binaries) {
+    const std::string vertexKey = resolvePath(vertex);
+    const std::string fragmentKey = resolvePath(fragment);
+    const std::string key = vertexKey + '|' + fragmentKey;
+
+    // Entries left by clear() keep their slot and are relinked in place.
+    auto it = programs.find(key);
+    if (it != programs.end() && bgfx::isValid(it->second.handle)) {
+        return &it->second;
+    }
+
+    auto binary = [&](const std::string& path) -> const std::vector<uint8_t>* {
+        if (!binaries) return nullptr;
+        auto found = binaries->find(path);
+        return found != binaries->end() ? &found->second : nullptr;
+    };
+    const bgfx::ShaderHandle vsh = createShader(vertexKey, binary(vertexKey));
+    const bgfx::ShaderHandle fsh = createShader(fragmentKey, binary(fragmentKey));
+
+    bgfx::ProgramHandle program = BGFX_INVALID_HANDLE;
+    if (bgfx::isValid(vsh) && bgfx::isValid(fsh)) {
+        // Shaders are shared between programs, so the program must not own them.
+        program = bgfx::createProgram(vsh, fsh, false);
+    }
+    if (!bgfx::isValid(program)) {
+        Log::error("Failed to create shader program: {} / {}", vertex, fragment);
+        // Drop shaders created just for this program.
+        for (const std::string* path : {&vertexKey, &fragmentKey}) {
+            auto unused = shaders.find(*path);
+            if (unused != shaders.end() && unused->second.users == 0) {
+                bgfx::destroy(unused->second.handle);
+                shaders.erase(unused);
+            }
+        }
+        return nullptr;
+    }
+
+    ++shaders[vertexKey].users;
+    ++shaders[fragmentKey].users;
+    ProgramEntry& entry = programs[key];
+    entry.handle = program;
+    entry.vertexKey = vertexKey;
+    entry.fragmentKey = fragmentKey;
+    Log::info("Shader program created: {} / {}", vertex, fragment);
+    return &entry;
+}
+
+void ShaderLibrary::releaseShader(const std::string& key) {
+    auto it = shaders.find(key);
+    if (it == shaders.end()) return;
+    if (it->second.users > 0) {
+        --it->second.users;
+    }
+    if (it->second.users == 0) {
+        bgfx::destroy(it->second.handle);
+        shaders.erase(it);
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,84 @@
+#pragma once
+#include <bgfx/bgfx.h>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+struct ShaderProgramDesc {
+    std::string vertex;    // Base name, e.g. "sprite.vert"
+    std::string fragment;
+};
+
+// Programs every renderer needs; preloaded when the Renderer starts
+extern const ShaderProgramDesc kBuiltinShaderPrograms[];
+extern const size_t kBuiltinShaderProgramCount;
+
+// Process-wide cache of compiled shaders and linked programs.
+// Each shader binary is read once per backend and each (vertex, fragment)
+// pair is linked once; Shader instances share the program and the last
+// release destroys it. Preloaded programs stay until clear(), which the
+// Renderer calls before shutting bgfx down.
+//
+// acquire() returns a slot that stays valid until released: reloadShader()
+// swaps the handle inside it, so every Shader picks up the new program.
+class ShaderLibrary {
+public:
+    static ShaderLibrary& instance();
+
+    // Reads every binary the programs need in one batch (files are read
+    // concurrently), then creates shaders and links the programs.
+    // Returns false if any program failed.
+    bool preload(std::span<const ShaderProgramDesc> programs);
+
+    // nullptr if the program cannot be loaded
+    const bgfx::ProgramHandle* acquire(const std::string& vertex, const std::string& fragment);
+    void release(const bgfx::ProgramHandle* program);
+
+    // Replaces a loaded shader (by base name) with new binary data and
+    // relinks every program using it. Call between frames. Leaves the old
+    // shader in place and returns false if anything fails to compile/link.
+    bool reloadShader(const std::string& baseName, const std::vector<uint8_t>& data);
+
+    // Destroys all GPU objects; acquired slots stay valid but hold invalid
+    // handles until released
+    void clear();
+
+    size_t getProgramCount() const { return programs.size(); }
+    size_t getShaderCount() const { return shaders.size(); }
+    uint32_t getRefCount(const bgfx::ProgramHandle* program) const;
+
+private:
+    ShaderLibrary() = default;
+
+    struct ShaderEntry {
+        bgfx::ShaderHandle handle = BGFX_INVALID_HANDLE;
+        uint32_t users = 0;  // Programs linked with this shader
+    };
+
+    struct ProgramEntry {
+        bgfx::ProgramHandle handle = BGFX_INVALID_HANDLE;
+        std::string vertexKey;
+        std::string fragmentKey;
+        uint32_t refs = 0;
+        bool pinned = false;  // Preloaded; kept alive with zero refs
+    };
+
+    std::unordered_map<std::string, ShaderEntry> shaders;    // Keyed by binary path
+    std::unordered_map<std::string, ProgramEntry> programs;  // Keyed by both paths; nodes are stable
+    bgfx::RendererType::Enum pathBackend = bgfx::RendererType::Count;
+    std::string pathPrefix;
+    std::string pathSuffix;
+
+    std::string resolvePath(const std::string& baseName);
+    bgfx::ShaderHandle createShader(const std::string& path, const std::vector<uint8_t>* data);
+    ProgramEntry* findOrLink(const std::string& vertex, const std::string& fragment,
+                             const std::unordered_map<std::string, std::vector<uint8_t>>* binaries);
+    void releaseShader(const std::string& key);
+    ProgramEntry* findEntry(const bgfx::ProgramHandle* program);
+};
+
+} // namespace Engine
@@ -1,4 +1,6 @@
 #include "sprite_batch.h"
+#include "texture_cache.h"
+#include "shader_library.h"
 #include "platform/logging.h"
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
@@ -10,25 +12,86 @@ bgfx::VertexLayout SpriteBatchVertex::layout;
 
 namespace {
 constexpr uint32_t kMaxSpritesPerBatch = 1024;
+
+uint64_t blendState(SpriteBlendMode mode, uint32_t variant) {
+    constexpr uint64_t kWrite = BGFX_STATE_WRITE_RGB | BGFX_STATE_WRITE_A | BGFX_STATE_MSAA;
+    // Vertex-color variants already output premultiplied color.
+    if (mode == SpriteBlendMode::Alpha && isPremultipliedSpriteVariant(variant)) {
+        mode = SpriteBlendMode::Premultiplied;
+    }
+    switch (mode) {
+    case SpriteBlendMode::Alpha:
+        return kWrite | BGFX_STATE_BLEND_ALPHA;
+    case SpriteBlendMode::Premultiplied:
+        return kWrite | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA);
+    case SpriteBlendMode::Opaque:
+    default:
+        return BGFX_STATE_DEFAULT | BGFX_STATE_MSAA;
+    }
+}
+
+SpriteShaderFeature withoutFeature(SpriteShaderFeature features, SpriteShaderFeature feature) {
+    return static_cast<SpriteShaderFeature>(static_cast<uint8_t>(features) & ~static_cast<uint8_t>(feature));
+}
+
+Color premultiply(const Color& color) {
+    auto scale = [&](uint8_t channel) { return static_cast<uint8_t>((channel * color.a + 127) / 255); };
+    return Color(scale(color.r), scale(color.g), scale(color.b), color.a);
+}
 } // namespace
 
 SpriteBatch::SpriteBatch()
     : u_mvp(BGFX_INVALID_HANDLE),
       s_texture(BGFX_INVALID_HANDLE),
+      s_palette(BGFX_INVALID_HANDLE),
+      viewId(0),
+      encoder(nullptr),
       spriteCount(0),
       currentTexture(BGFX_INVALID_HANDLE),
+      currentPalette(BGFX_INVALID_HANDLE),
+      currentVariant(0),
+      textureCache(nullptr),
+      blendMode(SpriteBlendMode::Opaque),
       initialized(false) {
     SpriteBatchVertex::init();
 
-    if (!spriteShader.load("sprite.vert", "sprite.frag")) {
+    // Read all variant binaries in one batch; missing variants fall back below.
+    ShaderProgramDesc variants[kSpriteShaderVariantCount];
+    for (uint32_t i = 0; i < kSpriteShaderVariantCount; ++i) {
+        variants[i] = {"sprite.vert", getSpriteFragmentName(i)};
+    }
+    ShaderLibrary::instance().preload(variants);
+    for (uint32_t i = 0; i < kSpriteShaderVariantCount; ++i) {
+        if (!variantShaders[i].load(variants[i].vertex, variants[i].fragment) && i > 0) {
+            Log::warn("SpriteBatch: shader variant {} unavailable, dropping features", variants[i].fragment);
+        }
+    }
+    if (!variantShaders[0].isValid()) {
         Log::critical("SpriteBatch failed to load sprite shader");
         return;
     }
+    // Drop AlphaTest, then keep only AlphaTest, then use the base shader.
+    for (uint32_t i = 0; i < kSpriteShaderVariantCount; ++i) {
+        const SpriteShaderFeature features = getSpriteVariantFeatures(i);
+        const uint32_t candidates[] = {
+            i,
+            getSpriteVariantIndex(withoutFeature(features, SpriteShaderFeature::AlphaTest)),
+            getSpriteVariantIndex(features & SpriteShaderFeature::AlphaTest),
+        };
+        variantFallback[i] = 0;
+        for (uint32_t candidate : candidates) {
+            if (variantShaders[candidate].isValid()) {
+                variantFallback[i] = candidate;
+                break;
+            }
+        }
+    }
 
     u_mvp = bgfx::createUniform("u_mvp", bgfx::UniformType::Mat4);
     s_texture = bgfx::createUniform("s_texture", bgfx::UniformType::Sampler);
+    s_palette = bgfx::createUniform("s_palette", bgfx::UniformType::Sampler);
 
-    if (!bgfx::isValid(u_mvp) || !bgfx::isValid(s_texture)) {
+    if (!bgfx::isValid(u_mvp) || !bgfx::isValid(s_texture) || !bgfx::isValid(s_palette)) {
         Log::critical("SpriteBatch failed to create uniforms");
         return;
     }
@@ -45,53 +108,95 @@ SpriteBatch::~SpriteBatch() {
     if (bgfx::isValid(s_texture)) {
         bgfx::destroy(s_texture);
     }
-    spriteShader.destroy();
+    if (bgfx::isValid(s_palette)) {
+        bgfx::destroy(s_palette);
+    }
+    for (Shader& shader : variantShaders) {
+        shader.destroy();
+    }
 }
 
-void SpriteBatch::begin(const Mat4& viewProj) {
+void SpriteBatch::begin(const Mat4& viewProj, bgfx::ViewId view, bgfx::Encoder* target) {
     if (!initialized) return;
     viewProjMatrix = viewProj;
+    viewId = view;
+    encoder = target;
     vertices.clear();
     indices.clear();
+    usedTextures.clear();
     spriteCount = 0;
     currentTexture = BGFX_INVALID_HANDLE;
+    currentPalette = BGFX_INVALID_HANDLE;
+    currentVariant = 0;
+}
+
+void SpriteBatch::setBlendMode(SpriteBlendMode mode) {
+    if (mode == blendMode) return;
+    flush();
+    blendMode = mode;
 }
 
 void SpriteBatch::draw(const SpriteDrawData& sprite) {
+    const float rad = toRadians(sprite.rotation);
+    draw(sprite, Affine2D::fromTRS(sprite.position, std::sin(rad), std::cos(rad), Vec2(1.0f, 1.0f)));
+}
+
+void SpriteBatch::draw(const SpriteDrawData& sprite, const Affine2D& transform) {
     if (!initialized) return;
-    if (!bgfx::isValid(sprite.texture)) return;
 
-    // Flush when texture changes to ensure correct binding.
-    if (bgfx::isValid(currentTexture) && currentTexture.idx != sprite.texture.idx) {
-        flush();
-    }
-    currentTexture = sprite.texture;
+    // Bindings follow the variant actually drawn, which may lack features.
+    const uint32_t variant = variantFallback[getSpriteVariantIndex(
+        normalizeSpriteFeatures(sprite.features, bgfx::isValid(sprite.palette)))];
+    const SpriteShaderFeature features = getSpriteVariantFeatures(variant);
 
-    const float rad = toRadians(sprite.rotation);
-    const float c = std::cos(rad);
-    const float s = std::sin(rad);
+    // Solid sprites sample nothing, so they batch regardless of texture.
+    const bool solid = hasFeature(features, SpriteShaderFeature::Solid);
+    if (!solid && !bgfx::isValid(sprite.texture)) return;
+    bgfx::TextureHandle texture = sprite.texture;
+    bgfx::TextureHandle palette = sprite.palette;
+    if (solid) {
+        texture = BGFX_INVALID_HANDLE;
+    }
+    if (!hasFeature(features, SpriteShaderFeature::Palette)) {
+        palette = BGFX_INVALID_HANDLE;
+    }
 
-    // Local quad corners
-    Vec2 local[4] = {
-        Vec2(0.0f, 0.0f),
-        Vec2(sprite.size.x, 0.0f),
-        Vec2(sprite.size.x, sprite.size.y),
-        Vec2(0.0f, sprite.size.y)
-    };
+    // Flush when the variant or any binding changes.
+    const bool textureChanged = currentTexture.idx != texture.idx;
+    if (spriteCount > 0 &&
+        (textureChanged || currentPalette.idx != palette.idx || currentVariant != variant)) {
+        flush();
+    }
+    if (textureChanged && !solid) {
+        usedTextures.push_back(texture);
+        if (textureCache) textureCache->markUsed(texture);
+    }
+    currentTexture = texture;
+    currentPalette = palette;
+    currentVariant = variant;
 
-    const uint32_t packedColor = sprite.color.toUint32();
+    // Corner 0 is the mapped -origin; the others add the mapped quad edges.
+    const Vec2 p0 = transform.apply(-sprite.origin);
+    const Vec2 edgeX(transform.a * sprite.size.x, transform.b * sprite.size.x);
+    const Vec2 edgeY(transform.c * sprite.size.y, transform.d * sprite.size.y);
+    const Vec2 p1 = p0 + edgeX;
+    const Vec2 p2 = p1 + edgeY;
+    const Vec2 p3 = p0 + edgeY;
 
-    auto rotateTranslate = [&](const Vec2& p) -> Vec2 {
-        Vec2 centered = p - sprite.origin;
-        return Vec2(centered.x * c - centered.y * s,
-                    centered.x * s + centered.y * c) + sprite.position;
-    };
+    // Premultiplied textures need a premultiplied tint; the vertex-color
+    // variants premultiply in the shader.
+    const bool premultiplyTint = blendMode == SpriteBlendMode::Premultiplied && !isPremultipliedSpriteVariant(variant);
+    const uint32_t packedColor = (premultiplyTint ? premultiply(sprite.color) : sprite.color).toUint32();
+    const float u0 = sprite.uvRect.x;
+    const float v0 = sprite.uvRect.y;
+    const float u1 = sprite.uvRect.x + sprite.uvRect.z;
+    const float v1 = sprite.uvRect.y + sprite.uvRect.w;
 
     const uint16_t base = static_cast<uint16_t>(vertices.size());
-    vertices.push_back({Vec3(rotateTranslate(local[0]), 0.0f), Vec2(sprite.uvRect.x, sprite.uvRect.y), packedColor});
-    vertices.push_back({Vec3(rotateTranslate(local[1]), 0.0f), Vec2(sprite.uvRect.x + sprite.uvRect.z, sprite.uvRect.y), packedColor});
-    vertices.push_back({Vec3(rotateTranslate(local[2]), 0.0f), Vec2(sprite.uvRect.x + sprite.uvRect.z, sprite.uvRect.y + sprite.uvRect.w), packedColor});
-    vertices.push_back({Vec3(rotateTranslate(local[3]), 0.0f), Vec2(sprite.uvRect.x, sprite.uvRect.y + sprite.uvRect.w), packedColor});
+    vertices.push_back({Vec3(p0, 0.0f), Vec2(u0, v0), packedColor});
+    vertices.push_back({Vec3(p1, 0.0f), Vec2(u1, v0), packedColor});
+    vertices.push_back({Vec3(p2, 0.0f), Vec2(u1, v1), packedColor});
+    vertices.push_back({Vec3(p3, 0.0f), Vec2(u0, v1), packedColor});
 
     indices.push_back(base + 0);
     indices.push_back(base + 1);
@@ -113,7 +218,7 @@ void SpriteBatch::end() {
 
 void SpriteBatch::flush() {
     if (!initialized) return;
-    if (vertices.empty() || !bgfx::isValid(currentTexture)) {
+    if (vertices.empty()) {
         vertices.clear();
         indices.clear();
         spriteCount = 0;
@@ -140,17 +245,28 @@ void SpriteBatch::flush() {
     std::memcpy(tvb.data, vertices.data(), vcount * sizeof(SpriteBatchVertex));
     std::memcpy(tib.data, indices.data(), icount * sizeof(uint16_t));
 
-    bgfx::setUniform(u_mvp, glm::value_ptr(viewProjMatrix));
-    bgfx::setVertexBuffer(0, &tvb);
-    bgfx::setIndexBuffer(&tib);
-    bgfx::setTexture(0, s_texture, currentTexture);
-    bgfx::setState(BGFX_STATE_DEFAULT | BGFX_STATE_MSAA);
-    bgfx::submit(0, spriteShader.getProgram());
+    // Transient allocation is thread-safe; everything else goes through the encoder.
+    bgfx::Encoder* target = encoder ? encoder : bgfx::begin();
+    target->setUniform(u_mvp, glm::value_ptr(viewProjMatrix));
+    target->setVertexBuffer(0, &tvb);
+    target->setIndexBuffer(&tib);
+    if (bgfx::isValid(currentTexture)) {
+        target->setTexture(0, s_texture, currentTexture);
+    }
+    if (bgfx::isValid(currentPalette)) {
+        target->setTexture(1, s_palette, currentPalette);
+    }
+    target->setState(blendState(blendMode, currentVariant));
+    target->submit(viewId, variantShaders[currentVariant].getProgram());
+    if (!encoder) {
+        bgfx::end(target);
+    }
 
     vertices.clear();
     indices.clear();
     spriteCount = 0;
     currentTexture = BGFX_INVALID_HANDLE;
+    currentPalette = BGFX_INVALID_HANDLE;
 }
 
 } // namespace Engine
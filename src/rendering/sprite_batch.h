@@ -1,13 +1,17 @@
 #pragma once
 #include "math/vector.h"
+#include "core/affine2d.h"
 #include "core/types.h"
 #include "shader.h"
+#include "sprite_shader_variants.h"
 #include "texture.h"
 #include <bgfx/bgfx.h>
 #include <vector>
 
 namespace Engine {
 
+class TextureCache;
+
 struct SpriteBatchVertex {
     Vec3 position;
     Vec2 texCoord;
@@ -25,6 +29,12 @@ struct SpriteBatchVertex {
     static bgfx::VertexLayout layout;
 };
 
+enum class SpriteBlendMode {
+    Opaque,         // BGFX_STATE_DEFAULT, no blending
+    Alpha,          // Straight alpha: src * a + dst * (1 - a)
+    Premultiplied   // src + dst * (1 - a); textures loaded with premultiplyAlpha, tints premultiplied by the batch
+};
+
 struct SpriteDrawData {
     bgfx::TextureHandle texture;
     Vec2 position;
@@ -33,6 +43,9 @@ struct SpriteDrawData {
     Vec2 origin;
     float rotation;
     Color color;
+    SpriteShaderFeature features = SpriteShaderFeature::None;
+    // Used with SpriteShaderFeature::Palette; load the index texture with paletteIndices
+    bgfx::TextureHandle palette = BGFX_INVALID_HANDLE;
 };
 
 class SpriteBatch {
@@ -40,21 +53,50 @@ public:
     SpriteBatch();
     ~SpriteBatch();
     
-    void begin(const Mat4& viewProj);
+    // With an encoder (from bgfx::begin(true)) the batch may be built and
+    // flushed on a worker thread; without one it submits through the
+    // main-thread encoder and must stay on the API thread. Use one batch
+    // per thread and leave the texture cache unset on worker batches; stamp
+    // getUsedTextures() on the API thread instead.
+    void begin(const Mat4& viewProj, bgfx::ViewId viewId = 0, bgfx::Encoder* encoder = nullptr);
     void draw(const SpriteDrawData& sprite);
+    // Places the sprite with a precomputed affine instead of position/rotation:
+    // corners (0,0)-(size) minus origin are mapped through `transform`.
+    // No trig or 4x4 math per sprite.
+    void draw(const SpriteDrawData& sprite, const Affine2D& transform);
+    // Sprites use the smallest shader variant for their features; the batch
+    // flushes when the variant, texture or palette changes. A variant that
+    // failed to load drops its features (AlphaTest first) down to the base
+    // shader; a Solid sprite without a texture is skipped in that case.
     void end();
+
+    // Stamps each texture's last-used frame in `cache` (nullptr to disable)
+    void setTextureCache(TextureCache* cache) { textureCache = cache; }
+    // Textures bound since begin(), one entry per texture change
+    const std::vector<bgfx::TextureHandle>& getUsedTextures() const { return usedTextures; }
+    // Applies to sprites drawn after the call (flushes on change)
+    void setBlendMode(SpriteBlendMode mode);
     
 private:
-    Shader spriteShader;
+    Shader variantShaders[kSpriteShaderVariantCount];  // Indexed by getSpriteVariantIndex()
+    uint32_t variantFallback[kSpriteShaderVariantCount];  // Requested -> nearest loaded variant
     bgfx::UniformHandle u_mvp;
     bgfx::UniformHandle s_texture;
+    bgfx::UniformHandle s_palette;
 
     std::vector<SpriteBatchVertex> vertices;
     std::vector<uint16_t> indices;
+    std::vector<bgfx::TextureHandle> usedTextures;
 
     Mat4 viewProjMatrix;
+    bgfx::ViewId viewId;
+    bgfx::Encoder* encoder;
     uint32_t spriteCount;
     bgfx::TextureHandle currentTexture;
+    bgfx::TextureHandle currentPalette;
+    uint32_t currentVariant;
+    TextureCache* textureCache;
+    SpriteBlendMode blendMode;
     bool initialized;
 
     void flush();
@@ -0,0 +1,77 @@
+#include "sprite_shader_variants.h"
+
+namespace Engine {
+
+namespace {
+// Index = color source * 2 + alpha test. Names must match SPRITE_FRAGMENT_VARIANTS in CMakeLists.txt.
+struct VariantInfo {
+    const char* fragment;
+    const char* defines;
+};
+
+constexpr VariantInfo kVariants[kSpriteShaderVariantCount] = {
+    {"sprite.frag", ""},
+    {"sprite_atest.frag", "SPRITE_ALPHA_TEST"},
+    {"sprite_solid.frag", "SPRITE_SOLID"},
+    {"sprite_solid_atest.frag", "SPRITE_SOLID;SPRITE_ALPHA_TEST"},
+    {"sprite_flash.frag", "SPRITE_FLASH"},
+    {"sprite_flash_atest.frag", "SPRITE_FLASH;SPRITE_ALPHA_TEST"},
+    {"sprite_palette.frag", "SPRITE_PALETTE"},
+    {"sprite_palette_atest.frag", "SPRITE_PALETTE;SPRITE_ALPHA_TEST"},
+};
+
+constexpr SpriteShaderFeature kColorSources[] = {
+    SpriteShaderFeature::None,
+    SpriteShaderFeature::Solid,
+    SpriteShaderFeature::Flash,
+    SpriteShaderFeature::Palette,
+};
+} // namespace
+
+SpriteShaderFeature normalizeSpriteFeatures(SpriteShaderFeature features, bool hasPalette) {
+    SpriteShaderFeature result = features & SpriteShaderFeature::AlphaTest;
+    if (hasFeature(features, SpriteShaderFeature::Solid)) {
+        result = result | SpriteShaderFeature::Solid;
+    } else if (hasFeature(features, SpriteShaderFeature::Flash)) {
+        result = result | SpriteShaderFeature::Flash;
+    } else if (hasFeature(features, SpriteShaderFeature::Palette) && hasPalette) {
+        result = result | SpriteShaderFeature::Palette;
+    }
+    return result;
+}
+
+uint32_t getSpriteVariantIndex(SpriteShaderFeature features) {
+    uint32_t colorSource = 0;
+    if (hasFeature(features, SpriteShaderFeature::Solid)) {
+        colorSource = 1;
+    } else if (hasFeature(features, SpriteShaderFeature::Flash)) {
+        colorSource = 2;
+    } else if (hasFeature(features, SpriteShaderFeature::Palette)) {
+        colorSource = 3;
+    }
+    return colorSource * 2 + (hasFeature(features, SpriteShaderFeature::AlphaTest) ? 1 : 0);
+}
+
+SpriteShaderFeature getSpriteVariantFeatures(uint32_t index) {
+    if (index >= kSpriteShaderVariantCount) return SpriteShaderFeature::None;
+    SpriteShaderFeature features = kColorSources[index / 2];
+    if (index % 2) {
+        features = features | SpriteShaderFeature::AlphaTest;
+    }
+    return features;
+}
+
+bool isPremultipliedSpriteVariant(uint32_t index) {
+    const SpriteShaderFeature features = getSpriteVariantFeatures(index);
+    return hasFeature(features, SpriteShaderFeature::Solid) || hasFeature(features, SpriteShaderFeature::Flash);
+}
+
+const char* getSpriteFragmentName(uint32_t index) {
+    return index < kSpriteShaderVariantCount ? kVariants[index].fragment : kVariants[0].fragment;
+}
+
+const char* getSpriteVariantDefines(uint32_t index) {
+    return index < kSpriteShaderVariantCount ? kVariants[index].defines : kVariants[0].defines;
+}
+
+} // namespace Engine
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+namespace Engine {
+
+// Optional sprite fragment features. Every valid combination is compiled
+// from sprite.frag.sc as its own variant by the compile_shaders target, so
+// a sprite only pays for what it uses.
+enum class SpriteShaderFeature : uint8_t {
+    None      = 0,
+    Solid     = 1 << 0,  // Vertex color only, no texture fetch
+    Flash     = 1 << 1,  // Vertex color masked by texture alpha (hit flash)
+    Palette   = 1 << 2,  // Texture red channel indexes a 256x1 palette texture
+    AlphaTest = 1 << 3,  // Discards fragments with alpha < 0.5
+};
+
+constexpr SpriteShaderFeature operator|(SpriteShaderFeature a, SpriteShaderFeature b) {
+    return static_cast<SpriteShaderFeature>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+constexpr SpriteShaderFeature operator&(SpriteShaderFeature a, SpriteShaderFeature b) {
+    return static_cast<SpriteShaderFeature>(static_cast<uint8_t>(a) & static_cast<uint8_t>(b));
+}
+
+constexpr bool hasFeature(SpriteShaderFeature features, SpriteShaderFeature feature) {
+    return (features & feature) != SpriteShaderFeature::None;
+}
+
+// Solid, Flash and Palette each replace the texture color and are exclusive;
+// AlphaTest combines with any of them.
+constexpr uint32_t kSpriteShaderVariantCount = 8;
+
+// Minimal feature set for a sprite: drops Palette without a palette texture
+// and resolves exclusive features by priority Solid > Flash > Palette.
+SpriteShaderFeature normalizeSpriteFeatures(SpriteShaderFeature features, bool hasPalette);
+
+// Dense index of a normalized feature set; 0 is the plain textured shader
+uint32_t getSpriteVariantIndex(SpriteShaderFeature features);
+SpriteShaderFeature getSpriteVariantFeatures(uint32_t index);
+
+// Solid and Flash build their color from the vertex color alone and output
+// it premultiplied, so they blend correctly under either blend mode.
+bool isPremultipliedSpriteVariant(uint32_t index);
+
+// Fragment base name as written by compile_shaders ("sprite.frag", "sprite_solid_atest.frag")
+const char* getSpriteFragmentName(uint32_t index);
+// shaderc --define list for the variant ("" for the base shader)
+const char* getSpriteVariantDefines(uint32_t index);
+
+} // namespace Engine
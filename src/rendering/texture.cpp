@@ -1,68 +1,289 @@
 #include "texture.h"
+#include "image_processing.h"
 #include "platform/file_system.h"
 #include "platform/logging.h"
+#include <bimg/bimg.h>
+#include <bx/allocator.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
 namespace Engine {
 
+namespace {
+
+constexpr uint64_t kSamplerFlags = BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT;
+
+struct CompressedVariant {
+    const char* suffix;
+    bgfx::TextureFormat::Enum format;
+};
+
+// Best quality first; desktop formats before mobile ones.
+constexpr CompressedVariant kCompressedVariants[] = {
+    {"bc7", bgfx::TextureFormat::BC7},
+    {"bc3", bgfx::TextureFormat::BC3},
+    {"bc1", bgfx::TextureFormat::BC1},
+    {"astc4x4", bgfx::TextureFormat::ASTC4x4},
+    {"etc2a", bgfx::TextureFormat::ETC2A},
+    {"etc2", bgfx::TextureFormat::ETC2},
+};
+
+bx::AllocatorI* imageAllocator() {
+    static bx::DefaultAllocator allocator;
+    return &allocator;
+}
+
+// DDS, KTX (v1) and PVR3 are parsed by bimg without decoding.
+bool isImageContainer(const void* data, uint32_t size) {
+    static constexpr uint8_t kKtxMagic[] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB};
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    if (size >= 4 && std::memcmp(bytes, "DDS ", 4) == 0) return true;
+    if (size >= 4 && std::memcmp(bytes, "PVR\x03", 4) == 0) return true;
+    return size >= sizeof(kKtxMagic) && std::memcmp(bytes, kKtxMagic, sizeof(kKtxMagic)) == 0;
+}
+
+struct DecodedImage {
+    std::vector<uint8_t> rgba;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+// stb_image decode to RGBA8. RGB images are expanded here (SIMD) rather
+// than by stb; gray and gray-alpha still go through stb's conversion.
+bool decodeImage(const void* data, uint32_t size, bool premultiply, DecodedImage& image) {
+    const auto* bytes = static_cast<const stbi_uc*>(data);
+    int w, h, channels;
+    if (!stbi_info_from_memory(bytes, static_cast<int>(size), &w, &h, &channels)) {
+        Log::error("Failed to decode image: {}", stbi_failure_reason());
+        return false;
+    }
+
+    const int requested = channels == 3 ? 3 : 4;
+    stbi_uc* pixels = stbi_load_from_memory(bytes, static_cast<int>(size), &w, &h, &channels, requested);
+    if (!pixels) {
+        Log::error("Failed to decode image: {}", stbi_failure_reason());
+        return false;
+    }
+
+    const size_t count = static_cast<size_t>(w) * h;
+    image.width = static_cast<uint32_t>(w);
+    image.height = static_cast<uint32_t>(h);
+    image.rgba.resize(count * 4);
+    if (requested == 3) {
+        expandRGBToRGBA({pixels, count * 3}, image.rgba);
+    } else {
+        std::memcpy(image.rgba.data(), pixels, count * 4);
+        if (premultiply) {
+            premultiplyAlpha(image.rgba);  // Opaque RGB needs no premultiply
+        }
+    }
+    stbi_image_free(pixels);
+    return true;
+}
+
+void releaseImage(void*, void* userData) {
+    bimg::imageFree(static_cast<bimg::ImageContainer*>(userData));
+}
+
+} // namespace
+
 Texture::~Texture() {
     destroy();
 }
 
-bool Texture::loadFromFile(const std::string& path) {
-    auto dataOpt = FileSystem::loadBinaryFile(path);
+bool Texture::loadFromFile(const std::string& path, const TextureLoadOptions& options) {
+    const std::string resolved = selectCompressedPath(path, options);
+    auto dataOpt = FileSystem::loadBinaryFile(resolved);
     if (!dataOpt) {
-        Log::error("Failed to load texture file: {}", path);
+        Log::error("Failed to load texture file: {}", resolved);
         return false;
     }
-    return loadFromMemory(dataOpt->data(), static_cast<uint32_t>(dataOpt->size()));
+    return loadFromMemory(dataOpt->data(), static_cast<uint32_t>(dataOpt->size()), options);
 }
 
-bool Texture::loadFromMemory(const void* data, uint32_t size) {
-    int w, h, channels;
-    stbi_uc* pixels = stbi_load_from_memory(
-        static_cast<const stbi_uc*>(data), size,
-        &w, &h, &channels, 4);
+std::string Texture::selectCompressedPath(const std::string& path, const TextureLoadOptions& options) {
+    if (bgfx::getCaps() == nullptr) {
+        return path;  // Renderer not initialized; nothing to match against
+    }
 
-    if (!pixels) {
-        Log::error("Failed to decode image: {}", stbi_failure_reason());
+    const std::string extension = FileSystem::getExtension(path);
+    const std::string stem = path.substr(0, path.size() - extension.size());
+    const char* alphaSuffix = options.wantsPremultiplied() ? ".pma.ktx" : ".ktx";
+    for (const CompressedVariant& variant : kCompressedVariants) {
+        if (!isFormatSupported(variant.format)) continue;
+        std::string candidate = stem + "." + variant.suffix + alphaSuffix;
+        if (FileSystem::fileExists(candidate)) {
+            return candidate;
+        }
+    }
+    return path;
+}
+
+bool Texture::isFormatSupported(bgfx::TextureFormat::Enum textureFormat) {
+    const bgfx::Caps* caps = bgfx::getCaps();
+    return caps && (caps->formats[textureFormat] & BGFX_CAPS_FORMAT_TEXTURE_2D) != 0;
+}
+
+bool Texture::loadFromMemory(const void* data, uint32_t size, const TextureLoadOptions& options) {
+    destroy();
+    if (isImageContainer(data, size)) {
+        return loadContainer(data, size);
+    }
+
+    DecodedImage image;
+    if (!decodeImage(data, size, options.wantsPremultiplied(), image)) {
         return false;
     }
 
-    width = static_cast<uint16_t>(w);
-    height = static_cast<uint16_t>(h);
+    width = static_cast<uint16_t>(image.width);
+    height = static_cast<uint16_t>(image.height);
 
-    const bgfx::Memory* mem = bgfx::copy(pixels, w * h * 4);
+    if (options.generateMips) {
+        image.rgba = buildMipChain(image.rgba.data(), width, height);
+    }
+    const bgfx::Memory* mem = bgfx::copy(image.rgba.data(), static_cast<uint32_t>(image.rgba.size()));
     handle = bgfx::createTexture2D(
         width, height,
-        false,
+        options.generateMips,
         1,
         bgfx::TextureFormat::RGBA8,
-        BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT,
+        kSamplerFlags,
         mem);
 
-    stbi_image_free(pixels);
-
     if (!bgfx::isValid(handle)) {
         Log::error("Failed to create BGFX texture");
         return false;
     }
 
+    setInfo(bgfx::TextureFormat::RGBA8, options.generateMips);
     Log::info("Texture loaded: {}x{}", width, height);
     return true;
 }
 
+bool Texture::loadContainer(const void* data, uint32_t size) {
+    bimg::ImageContainer* image = bimg::imageParse(imageAllocator(), data, size);
+    if (!image) {
+        Log::error("Failed to parse texture container");
+        return false;
+    }
+    if (image->m_cubeMap || image->m_depth > 1 || image->m_numLayers > 1) {
+        Log::error("Unsupported texture container: only 2D textures are supported");
+        bimg::imageFree(image);
+        return false;
+    }
+
+    auto textureFormat = static_cast<bgfx::TextureFormat::Enum>(image->m_format);
+    if (!isFormatSupported(textureFormat)) {
+        // Decode on the CPU rather than failing; costs the VRAM savings only.
+        Log::warn("Texture format {} unsupported by renderer, decoding to RGBA8",
+                  bimg::getName(image->m_format));
+        bimg::ImageContainer* converted = bimg::imageConvert(imageAllocator(), bimg::TextureFormat::RGBA8, *image);
+        bimg::imageFree(image);
+        if (!converted) {
+            Log::error("Failed to decode compressed texture");
+            return false;
+        }
+        image = converted;
+        textureFormat = bgfx::TextureFormat::RGBA8;
+    }
+
+    width = static_cast<uint16_t>(image->m_width);
+    height = static_cast<uint16_t>(image->m_height);
+    const bool hasMips = image->m_numMips > 1;
+    const char* formatName = bimg::getName(image->m_format);
+
+    // bgfx reads the container data directly and frees it once uploaded.
+    const bgfx::Memory* mem = bgfx::makeRef(image->m_data, image->m_size, releaseImage, image);
+    handle = bgfx::createTexture2D(width, height, hasMips, 1, textureFormat, kSamplerFlags, mem);
+    if (!bgfx::isValid(handle)) {
+        Log::error("Failed to create BGFX texture ({}x{}, {})", width, height, formatName);
+        return false;
+    }
+
+    setInfo(textureFormat, hasMips);
+    Log::info("Texture loaded: {}x{} {} ({} mips)", width, height, formatName, mipCount);
+    return true;
+}
+
+bool Texture::loadPreview(const void* data, uint32_t size, uint16_t maxDimension,
+                          const TextureLoadOptions& options) {
+    destroy();
+    maxDimension = std::max<uint16_t>(maxDimension, 4);
+
+    if (isImageContainer(data, size)) {
+        bimg::ImageContainer* image = bimg::imageParse(imageAllocator(), data, size);
+        if (!image) {
+            Log::error("Failed to parse texture container");
+            return false;
+        }
+        auto textureFormat = static_cast<bgfx::TextureFormat::Enum>(image->m_format);
+        if (!isFormatSupported(textureFormat)) {
+            bimg::ImageContainer* converted = bimg::imageConvert(imageAllocator(), bimg::TextureFormat::RGBA8, *image);
+            bimg::imageFree(image);
+            if (!converted) return false;
+            image = converted;
+            textureFormat = bgfx::TextureFormat::RGBA8;
+        }
+
+        // Compressed blocks are 4x4, so stop at a 4 texel edge.
+        uint8_t lod = 0;
+        while (lod + 1 < image->m_numMips &&
+               std::max(image->m_width >> lod, image->m_height >> lod) > maxDimension &&
+               std::min(image->m_width >> (lod + 1), image->m_height >> (lod + 1)) >= 4) {
+            ++lod;
+        }
+
+        bimg::ImageMip mip;
+        bool created = false;
+        if (bimg::imageGetRawData(*image, 0, lod, image->m_data, image->m_size, mip)) {
+            width = static_cast<uint16_t>(mip.m_width);
+            height = static_cast<uint16_t>(mip.m_height);
+            handle = bgfx::createTexture2D(width, height, false, 1, textureFormat, kSamplerFlags,
+                                           bgfx::copy(mip.m_data, mip.m_size));
+            created = bgfx::isValid(handle);
+        }
+        bimg::imageFree(image);
+        if (!created) {
+            Log::error("Failed to create texture preview");
+            return false;
+        }
+        setInfo(textureFormat, false);
+        return true;
+    }
+
+    DecodedImage image;
+    if (!decodeImage(data, size, options.wantsPremultiplied(), image)) {
+        return false;
+    }
+
+    // Halve until it fits; odd edges reuse the last texel.
+    std::vector<uint8_t> next;
+    while (std::max(image.width, image.height) > maxDimension) {
+        const uint32_t nw = std::max(1u, image.width / 2);
+        const uint32_t nh = std::max(1u, image.height / 2);
+        next.resize(static_cast<size_t>(nw) * nh * 4);
+        downsampleBox(image.rgba.data(), image.width, image.height, next.data());
+        image.rgba.swap(next);
+        image.width = nw;
+        image.height = nh;
+    }
+    return loadFromRGBA(static_cast<uint16_t>(image.width), static_cast<uint16_t>(image.height), image.rgba.data());
+}
+
 bool Texture::loadFromRGBA(uint16_t w, uint16_t h, const uint8_t* rgba, bool generateMips) {
     if (!rgba) {
         Log::error("RGBA buffer is null");
         return false;
     }
+    destroy();
     width = w;
     height = h;
     const bgfx::Memory* mem = bgfx::copy(rgba, static_cast<uint32_t>(w) * h * 4);
-    uint64_t flags = BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT;
+    uint64_t flags = kSamplerFlags;
     handle = bgfx::createTexture2D(
         width, height,
         generateMips,
@@ -75,16 +296,27 @@ bool Texture::loadFromRGBA(uint16_t w, uint16_t h, const uint8_t* rgba, bool gen
         Log::error("Failed to create BGFX texture from RGBA buffer");
         return false;
     }
+    setInfo(bgfx::TextureFormat::RGBA8, generateMips);
     Log::info("Texture created from RGBA buffer: {}x{}", width, height);
     return true;
 }
 
+void Texture::setInfo(bgfx::TextureFormat::Enum textureFormat, bool hasMips) {
+    bgfx::TextureInfo info;
+    bgfx::calcTextureSize(info, width, height, 1, false, hasMips, 1, textureFormat);
+    format = textureFormat;
+    mipCount = info.numMips;
+    memorySize = info.storageSize;
+}
+
 void Texture::destroy() {
     if (bgfx::isValid(handle)) {
         bgfx::destroy(handle);
         handle = BGFX_INVALID_HANDLE;
     }
+    format = bgfx::TextureFormat::Unknown;
+    mipCount = 0;
+    memorySize = 0;
 }
 
 } // namespace Engine
-
@@ -4,17 +4,47 @@
 
 namespace Engine {
 
+struct TextureLoadOptions {
+    bool premultiplyAlpha = false;  // Pair with SpriteBlendMode::Premultiplied
+    bool generateMips = false;      // Box-filtered on the CPU
+    bool paletteIndices = false;    // Red channel indexes a palette; never premultiplied
+
+    bool wantsPremultiplied() const { return premultiplyAlpha && !paletteIndices; }
+};
+
 class Texture {
 public:
     Texture() = default;
     ~Texture();
 
-    bool loadFromFile(const std::string& path);
-    bool loadFromMemory(const void* data, uint32_t size);
+    // KTX/DDS/PVR containers are uploaded as-is (compressed formats, full
+    // mip chain); anything else is decoded to RGBA8 with stb_image.
+    // loadFromFile prefers a compressed sibling of `path` the GPU supports
+    // and baked with the requested alpha mode, see selectCompressedPath().
+    // Other `options` only apply to decoded images; containers are uploaded
+    // with the alpha and mips they were baked with.
+    bool loadFromFile(const std::string& path, const TextureLoadOptions& options = {});
+    bool loadFromMemory(const void* data, uint32_t size, const TextureLoadOptions& options = {});
     bool loadFromRGBA(uint16_t w, uint16_t h, const uint8_t* rgba, bool generateMips = false);
+    // Low-resolution copy of an encoded image (used as a streaming
+    // placeholder): the largest container mip no bigger than maxDimension,
+    // or a box-filtered downscale of a regular image.
+    bool loadPreview(const void* data, uint32_t size, uint16_t maxDimension,
+                     const TextureLoadOptions& options = {});
+
+    // "<dir>/<stem>.<format>.ktx" variants written by tools/compress_textures.py
+    // (".<format>.pma.ktx" when options.wantsPremultiplied()), tried best
+    // first (BC7, BC3, BC1, ASTC, ETC2) and kept only if the renderer
+    // supports the format. Returns `path` when none applies, so the source
+    // image is decoded and premultiplied on the CPU instead.
+    static std::string selectCompressedPath(const std::string& path, const TextureLoadOptions& options = {});
+    static bool isFormatSupported(bgfx::TextureFormat::Enum format);
 
     uint16_t getWidth() const { return width; }
     uint16_t getHeight() const { return height; }
+    bgfx::TextureFormat::Enum getFormat() const { return format; }
+    uint8_t getMipCount() const { return mipCount; }
+    uint32_t getMemorySize() const { return memorySize; }  // Estimated VRAM bytes
     bgfx::TextureHandle getHandle() const { return handle; }
     bool isValid() const { return bgfx::isValid(handle); }
 
@@ -24,6 +54,12 @@ private:
     bgfx::TextureHandle handle = BGFX_INVALID_HANDLE;
     uint16_t width = 0;
     uint16_t height = 0;
+    bgfx::TextureFormat::Enum format = bgfx::TextureFormat::Unknown;
+    uint8_t mipCount = 0;
+    uint32_t memorySize = 0;
+
+    bool loadContainer(const void* data, uint32_t size);
+    void setInfo(bgfx::TextureFormat::Enum textureFormat, bool hasMips);
 };
 
 } // namespace Engine
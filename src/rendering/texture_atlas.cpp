@@ -1,4 +1,5 @@
 #include "texture_atlas.h"
+#include "core/memory_tracker.h"
 #include "platform/logging.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
@@ -8,6 +9,7 @@ namespace Engine {
 
 bool TextureAtlas::load_from_file(const std::string& texture_path,
                                   const std::string& metadata_path) {
+    MemoryTagScope memoryTag(MemoryTag::Assets);
     clear();
 
     // Texture loading is handled elsewhere in the BGFX pipeline; keep path for future use.
@@ -157,6 +159,14 @@ std::vector<std::string> TextureAtlas::get_animation_names() const {
     return names;
 }
 
+FrameVector<std::string_view> TextureAtlas::get_animation_names(FrameAllocator& arena) const {
+    auto names = makeFrameVector<std::string_view>(arena, animations.size());
+    for (const auto& [name, _] : animations) {
+        names.push_back(name);
+    }
+    return names;
+}
+
 bool TextureAtlas::has_animation(const std::string& name) const {
     return animations.find(name) != animations.end();
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <glm/glm.hpp>
+#include "core/frame_allocator.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <cstdint>
@@ -68,6 +70,8 @@ public:
     // Animation access
     const AnimationData* get_animation(const std::string& name) const;
     std::vector<std::string> get_animation_names() const;
+    // Per-frame variant: views into the atlas' names, no heap allocation
+    FrameVector<std::string_view> get_animation_names(FrameAllocator& arena) const;
     bool has_animation(const std::string& name) const;
     
     // Texture info
@@ -0,0 +1,204 @@
+#include "texture_cache.h"
+#include "core/memory_tracker.h"
+#include "platform/file_system.h"
+#include "platform/logging.h"
+#include <chrono>
+
+namespace Engine {
+
+TextureCache::TextureCache(const TextureCacheConfig& config)
+    : config(config), residency(config.budgetBytes) {}
+
+TextureCache::~TextureCache() {
+    clear();
+}
+
+TextureCacheId TextureCache::load(const std::string& path) {
+    MemoryTagScope memoryTag(MemoryTag::Assets);
+    const std::string resolved = Texture::selectCompressedPath(path, config.loadOptions);
+    auto data = FileSystem::loadBinaryFile(resolved);
+    if (!data) {
+        Log::error("Failed to load texture file: {}", resolved);
+        return kInvalidTextureCacheId;
+    }
+
+    const TextureCacheId id = entries.create();
+    Entry& entry = *entries.get(id);
+    entry.path = resolved;
+    if (!upload(id, entry, *data)) {
+        entries.destroy(id);
+        return kInvalidTextureCacheId;
+    }
+
+    if (config.placeholderSize > 0) {
+        auto placeholder = std::make_unique<Texture>();
+        if (placeholder->loadPreview(data->data(), static_cast<uint32_t>(data->size()), config.placeholderSize,
+                                     config.loadOptions)) {
+            placeholderBytes += placeholder->getMemorySize();
+            mapHandle(placeholder.get(), id);
+            entry.placeholder = std::move(placeholder);
+        }
+    }
+    return id;
+}
+
+void TextureCache::unload(TextureCacheId id) {
+    Entry* entry = entries.get(id);
+    if (!entry) return;
+    if (entry->pending.valid()) {
+        entry->pending.wait();
+    }
+    evict(id, *entry);
+    if (entry->placeholder) {
+        placeholderBytes -= entry->placeholder->getMemorySize();
+        mapHandle(entry->placeholder.get(), kInvalidTextureCacheId);
+    }
+    entries.destroy(id);
+}
+
+void TextureCache::clear() {
+    while (!entries.empty()) {
+        unload(entries.handleAt(entries.size() - 1));
+    }
+    idByHandle.clear();
+}
+
+uint16_t TextureCache::getWidth(TextureCacheId id) const {
+    const Entry* entry = entries.get(id);
+    return entry ? entry->width : 0;
+}
+
+uint16_t TextureCache::getHeight(TextureCacheId id) const {
+    const Entry* entry = entries.get(id);
+    return entry ? entry->height : 0;
+}
+
+bgfx::TextureHandle TextureCache::get(TextureCacheId id) {
+    Entry* found = entries.get(id);
+    if (!found) return BGFX_INVALID_HANDLE;
+    Entry& entry = *found;
+
+    if (entry.state == State::Evicted) {
+        if (config.asyncReload) {
+            entry.pending = std::async(std::launch::async, [path = entry.path] {
+                MemoryTagScope memoryTag(MemoryTag::Assets);
+                return FileSystem::loadBinaryFile(path);
+            });
+            entry.state = State::Streaming;
+        } else {
+            auto data = FileSystem::loadBinaryFile(entry.path);
+            if (data && upload(id, entry, *data)) {
+                ++reloads;
+            } else {
+                Log::error("Failed to reload texture: {}", entry.path);
+                entry.state = State::Failed;
+            }
+        }
+    }
+
+    if (entry.state == State::Resident) {
+        return entry.texture->getHandle();
+    }
+    if (entry.placeholder) {
+        return entry.placeholder->getHandle();
+    }
+    return BGFX_INVALID_HANDLE;
+}
+
+const Texture* TextureCache::getTexture(TextureCacheId id) const {
+    const Entry* entry = entries.get(id);
+    return entry && entry->state == State::Resident ? entry->texture.get() : nullptr;
+}
+
+bool TextureCache::isResident(TextureCacheId id) const {
+    const Entry* entry = entries.get(id);
+    return entry && entry->state == State::Resident;
+}
+
+bool TextureCache::hasFailed(TextureCacheId id) const {
+    const Entry* entry = entries.get(id);
+    return entry && entry->state == State::Failed;
+}
+
+void TextureCache::markUsed(bgfx::TextureHandle handle) {
+    if (!bgfx::isValid(handle) || handle.idx >= idByHandle.size()) return;
+    const TextureCacheId id = idByHandle[handle.idx];
+    if (id.isValid()) {
+        residency.markUsed(id.index);
+    }
+}
+
+void TextureCache::markUsed(TextureCacheId id) {
+    if (isValid(id)) {
+        residency.markUsed(id.index);
+    }
+}
+
+void TextureCache::update() {
+    // Streamed reloads: the file read ran on a worker, the decode and
+    // upload happen here, a few per frame to avoid hitches.
+    MemoryTagScope memoryTag(MemoryTag::Assets);
+    uint32_t uploads = 0;
+    for (size_t i = 0; i < entries.size() && uploads < config.maxUploadsPerFrame; ++i) {
+        Entry& entry = entries[i];
+        if (entry.state != State::Streaming ||
+            entry.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+        auto data = entry.pending.get();
+        if (data && upload(entries.handleAt(i), entry, *data)) {
+            ++reloads;
+            ++uploads;
+        } else {
+            // Reported once; get() no longer re-reads the file every frame.
+            Log::error("Failed to reload texture: {}", entry.path);
+            entry.state = State::Failed;
+        }
+    }
+
+    for (TextureResidency::Key slot : residency.evict(config.minIdleFrames)) {
+        const TextureCacheId id = entries.getHandle(slot);
+        if (Entry* entry = entries.get(id)) {
+            evict(id, *entry);
+        }
+    }
+    residency.beginFrame();
+}
+
+bool TextureCache::upload(TextureCacheId id, Entry& entry, const std::vector<uint8_t>& data) {
+    auto texture = std::make_unique<Texture>();
+    if (!texture->loadFromMemory(data.data(), static_cast<uint32_t>(data.size()), config.loadOptions)) {
+        return false;
+    }
+
+    entry.width = texture->getWidth();
+    entry.height = texture->getHeight();
+    entry.state = State::Resident;
+    mapHandle(texture.get(), id);
+    residency.insert(id.index, texture->getMemorySize());
+    entry.texture = std::move(texture);
+    return true;
+}
+
+void TextureCache::evict(TextureCacheId id, Entry& entry) {
+    residency.erase(id.index);
+    if (entry.texture) {
+        // bgfx defers the destroy until submitted draws have rendered.
+        mapHandle(entry.texture.get(), kInvalidTextureCacheId);
+        entry.texture.reset();
+    }
+    if (entry.state == State::Resident) {
+        entry.state = State::Evicted;
+    }
+}
+
+void TextureCache::mapHandle(const Texture* texture, TextureCacheId id) {
+    const bgfx::TextureHandle handle = texture->getHandle();
+    if (!bgfx::isValid(handle)) return;
+    if (handle.idx >= idByHandle.size()) {
+        idByHandle.resize(handle.idx + 1, kInvalidTextureCacheId);
+    }
+    idByHandle[handle.idx] = id;
+}
+
+} // namespace Engine
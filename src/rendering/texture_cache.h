@@ -0,0 +1,100 @@
+#pragma once
+#include "texture.h"
+#include "texture_residency.h"
+#include "core/handle_pool.h"
+#include <bgfx/bgfx.h>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+struct TextureCacheTag;
+// Generational: an id goes stale when its texture is unloaded
+using TextureCacheId = PoolHandle<TextureCacheTag>;
+constexpr TextureCacheId kInvalidTextureCacheId{};
+
+struct TextureCacheConfig {
+    uint64_t budgetBytes = 256ull * 1024 * 1024;  // Estimated VRAM for full-resolution textures
+    uint32_t minIdleFrames = 2;       // Textures drawn this recently are never evicted
+    uint32_t maxUploadsPerFrame = 2;  // Streamed reloads uploaded per update()
+    bool asyncReload = true;          // Read evicted files on a worker thread
+    uint16_t placeholderSize = 0;     // > 0 keeps a low-res copy (edge <= this) while evicted
+    TextureLoadOptions loadOptions;
+};
+
+// Owns file-backed textures and keeps their estimated VRAM under a budget.
+// SpriteBatch stamps the frame a texture was last drawn (see
+// SpriteBatch::setTextureCache); update() evicts the least recently drawn
+// textures when over budget. Evicted textures reload the next time get() is
+// called; while streaming, get() returns the placeholder if one was kept,
+// otherwise an invalid handle (SpriteBatch skips those sprites). A reload
+// that fails is not retried: the entry keeps returning its placeholder (or
+// an invalid handle) until it is unloaded and loaded again.
+class TextureCache {
+public:
+    explicit TextureCache(const TextureCacheConfig& config = {});
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // Loads synchronously the first time; returns kInvalidTextureCacheId on failure.
+    TextureCacheId load(const std::string& path);
+    void unload(TextureCacheId id);
+    void clear();
+
+    // Handle to draw with this frame, requesting a reload if evicted
+    bgfx::TextureHandle get(TextureCacheId id);
+    const Texture* getTexture(TextureCacheId id) const;  // nullptr while evicted
+    bool isResident(TextureCacheId id) const;
+    bool hasFailed(TextureCacheId id) const;  // Reload failed; see above
+    bool isValid(TextureCacheId id) const { return entries.contains(id); }
+    size_t getTextureCount() const { return entries.size(); }
+    // Full-resolution size, known even while evicted
+    uint16_t getWidth(TextureCacheId id) const;
+    uint16_t getHeight(TextureCacheId id) const;
+
+    void markUsed(bgfx::TextureHandle handle);  // Called by SpriteBatch on texture changes
+    void markUsed(TextureCacheId id);
+
+    // Once per frame: uploads finished reloads, enforces the budget and
+    // advances the frame counter.
+    void update();
+
+    void setBudget(uint64_t bytes) { residency.setBudget(bytes); }
+    uint64_t getBudget() const { return residency.getBudget(); }
+    uint64_t getResidentBytes() const { return residency.getUsedBytes(); }
+    uint64_t getPlaceholderBytes() const { return placeholderBytes; }
+    uint64_t getEvictionCount() const { return residency.getEvictionCount(); }
+    uint64_t getReloadCount() const { return reloads; }
+
+private:
+    enum class State : uint8_t { Resident, Evicted, Streaming, Failed };
+
+    struct Entry {
+        std::string path;  // Resolved (possibly compressed) file
+        std::unique_ptr<Texture> texture;
+        std::unique_ptr<Texture> placeholder;
+        std::future<std::optional<std::vector<uint8_t>>> pending;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        State state = State::Evicted;
+    };
+
+    TextureCacheConfig config;
+    TextureResidency residency;  // Keyed by slot index (TextureCacheId::index)
+    HandlePool<Entry, TextureCacheTag> entries;
+    std::vector<TextureCacheId> idByHandle;  // bgfx handle idx -> id, for markUsed
+    uint64_t placeholderBytes = 0;
+    uint64_t reloads = 0;
+
+    bool upload(TextureCacheId id, Entry& entry, const std::vector<uint8_t>& data);
+    void evict(TextureCacheId id, Entry& entry);
+    void mapHandle(const Texture* texture, TextureCacheId id);
+};
+
+} // namespace Engine
@@ -0,0 +1,213 @@
+#include "texture_registry.h"
+#include "core/memory_tracker.h"
+#include "platform/file_system.h"
+#include "platform/logging.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+namespace Engine {
+
+namespace {
+// releasedFrame while a reference exists (or was just re-acquired)
+constexpr uint64_t kInUse = UINT64_MAX;
+} // namespace
+
+TextureRef::TextureRef(TextureRegistry* registry, TextureRegistryEntry* entry)
+    : registry(registry), entry(entry) {}
+
+TextureRef::TextureRef(const TextureRef& other) : registry(other.registry), entry(other.entry) {
+    if (entry) {
+        entry->refs.fetch_add(1);
+    }
+}
+
+TextureRef::TextureRef(TextureRef&& other) noexcept : registry(other.registry), entry(other.entry) {
+    other.registry = nullptr;
+    other.entry = nullptr;
+}
+
+TextureRef& TextureRef::operator=(const TextureRef& other) {
+    if (this != &other) {
+        TextureRef copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+TextureRef& TextureRef::operator=(TextureRef&& other) noexcept {
+    if (this != &other) {
+        reset();
+        registry = other.registry;
+        entry = other.entry;
+        other.registry = nullptr;
+        other.entry = nullptr;
+    }
+    return *this;
+}
+
+void TextureRef::reset() {
+    if (entry && entry->refs.fetch_sub(1) == 1) {
+        registry->release(entry);
+    }
+    registry = nullptr;
+    entry = nullptr;
+}
+
+TextureLoadState TextureRef::getState() const {
+    return entry ? entry->state.load() : TextureLoadState::Failed;
+}
+
+bgfx::TextureHandle TextureRef::getHandle() const {
+    bgfx::TextureHandle handle = BGFX_INVALID_HANDLE;
+    if (entry) {
+        handle.idx = entry->handleIdx.load();
+    }
+    return handle;
+}
+
+const Texture* TextureRef::getTexture() const {
+    return isReady() ? entry->texture.get() : nullptr;
+}
+
+const std::string& TextureRef::getPath() const {
+    static const std::string empty;
+    return entry ? entry->path : empty;
+}
+
+TextureRegistry::~TextureRegistry() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [path, entry] : entries) {
+        if (entry->refs.load() > 0) {
+            Log::warn("TextureRegistry destroyed while '{}' is still referenced", path);
+        }
+        if (entry->pending.valid()) {
+            entry->pending.wait();
+        }
+    }
+    entries.clear();
+}
+
+TextureRef TextureRegistry::load(const std::string& path) {
+    TextureRef ref = acquire(path);
+    if (ref.getState() == TextureLoadState::Loading) {
+        finishLoad(ref.entry);
+    }
+    return ref;
+}
+
+TextureRef TextureRegistry::loadAsync(const std::string& path) {
+    return acquire(path);
+}
+
+TextureRef TextureRegistry::acquire(const std::string& path) {
+    const std::string key = normalizePath(path);
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        auto entry = std::make_unique<Entry>();
+        entry->path = key;
+        entry->pending = std::async(std::launch::async, [resolved = Texture::selectCompressedPath(key, config.loadOptions)] {
+            MemoryTagScope memoryTag(MemoryTag::Assets);
+            return FileSystem::loadBinaryFile(resolved);
+        }).share();
+        loading.push_back(entry.get());
+        it = entries.emplace(key, std::move(entry)).first;
+    }
+
+    Entry* entry = it->second.get();
+    entry->refs.fetch_add(1);
+    entry->releasedFrame = kInUse;
+    return TextureRef(this, entry);
+}
+
+void TextureRegistry::finishLoad(Entry* entry) {
+    if (entry->state.load() != TextureLoadState::Loading) return;
+
+    // Decode and upload here, on the render thread; only the read was async.
+    const auto& data = entry->pending.get();
+    auto texture = std::make_unique<Texture>();
+    if (data && texture->loadFromMemory(data->data(), static_cast<uint32_t>(data->size()), config.loadOptions)) {
+        entry->handleIdx.store(texture->getHandle().idx);
+        entry->texture = std::move(texture);
+        entry->state.store(TextureLoadState::Ready);
+        ++uploads;
+    } else {
+        Log::error("Failed to load texture: {}", entry->path);
+        entry->state.store(TextureLoadState::Failed);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entry->pending = {};
+    loading.erase(std::remove(loading.begin(), loading.end(), entry), loading.end());
+}
+
+void TextureRegistry::release(Entry* entry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entry->refs.load() > 0) return;  // Re-acquired meanwhile
+    entry->releasedFrame = frame;
+    if (!entry->queuedForRelease) {
+        entry->queuedForRelease = true;
+        releaseQueue.push_back(entry);
+    }
+}
+
+void TextureRegistry::update() {
+    std::vector<Entry*> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Entry* entry : loading) {
+            if (ready.size() >= config.maxUploadsPerFrame) break;
+            if (entry->pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                ready.push_back(entry);
+            }
+        }
+    }
+    for (Entry* entry : ready) {
+        finishLoad(entry);
+    }
+
+    destroyUnreferenced(config.destroyDelayFrames);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++frame;
+}
+
+void TextureRegistry::collect() {
+    destroyUnreferenced(0);
+}
+
+void TextureRegistry::destroyUnreferenced(uint32_t minFrames) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto expired = [&](Entry* entry) {
+        if (entry->refs.load() > 0) {
+            entry->queuedForRelease = false;  // Back in use; release() re-queues it
+            return true;
+        }
+        // Wait for in-flight reads, and for a racing release() to stamp the frame.
+        if (entry->state.load() == TextureLoadState::Loading || entry->releasedFrame == kInUse ||
+            frame - entry->releasedFrame < minFrames) {
+            return false;
+        }
+        entries.erase(entry->path);  // Destroys the texture
+        return true;
+    };
+    releaseQueue.erase(std::remove_if(releaseQueue.begin(), releaseQueue.end(), expired), releaseQueue.end());
+}
+
+size_t TextureRegistry::getTextureCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+size_t TextureRegistry::getPendingReleaseCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return releaseQueue.size();
+}
+
+std::string TextureRegistry::normalizePath(const std::string& path) {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+} // namespace Engine
@@ -0,0 +1,127 @@
+#pragma once
+#include "texture.h"
+#include <bgfx/bgfx.h>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+class TextureRegistry;
+
+struct TextureRegistryConfig {
+    uint32_t destroyDelayFrames = 2;  // Frames an unreferenced texture survives (GPU may still use it)
+    uint32_t maxUploadsPerFrame = 4;  // Async loads uploaded per update()
+    TextureLoadOptions loadOptions;
+};
+
+enum class TextureLoadState : uint8_t { Loading, Ready, Failed };
+
+// Registry bookkeeping for one path; owned by TextureRegistry
+struct TextureRegistryEntry {
+    std::string path;
+    std::unique_ptr<Texture> texture;
+    std::shared_future<std::optional<std::vector<uint8_t>>> pending;  // File read
+    std::atomic<uint32_t> refs{0};
+    std::atomic<TextureLoadState> state{TextureLoadState::Loading};
+    std::atomic<uint16_t> handleIdx{bgfx::kInvalidHandle};
+    uint64_t releasedFrame = 0;
+    bool queuedForRelease = false;
+};
+
+// Shared reference to a registry texture. Copies share one GPU texture;
+// the registry destroys it a few frames after the last reference is gone.
+// Handles may be copied and released on any thread.
+class TextureRef {
+public:
+    TextureRef() = default;
+    TextureRef(const TextureRef& other);
+    TextureRef(TextureRef&& other) noexcept;
+    TextureRef& operator=(const TextureRef& other);
+    TextureRef& operator=(TextureRef&& other) noexcept;
+    ~TextureRef() { reset(); }
+
+    void reset();
+    explicit operator bool() const { return entry != nullptr; }
+
+    TextureLoadState getState() const;
+    bool isReady() const { return getState() == TextureLoadState::Ready; }
+    bgfx::TextureHandle getHandle() const;  // Invalid until ready
+    const Texture* getTexture() const;      // nullptr until ready (render thread only)
+    const std::string& getPath() const;
+    uint32_t getRefCount() const { return entry ? entry->refs.load() : 0; }
+
+    bool operator==(const TextureRef& other) const { return entry == other.entry; }
+
+private:
+    friend class TextureRegistry;
+    TextureRef(TextureRegistry* registry, TextureRegistryEntry* entry);  // Adopts one reference
+
+    TextureRegistry* registry = nullptr;
+    TextureRegistryEntry* entry = nullptr;
+};
+
+// Path-keyed texture registry: each path is read, decoded and uploaded
+// once no matter how many scenes or entities ask for it. Requests for a
+// path that is still loading join the pending load instead of starting
+// another. Textures are destroyed in update(), destroyDelayFrames after the
+// last TextureRef went away; re-acquiring before then reuses the texture.
+// A failed load is cached like a loaded one: the path keeps returning
+// Failed refs, without touching the file again, until the last ref is gone
+// and the entry expired. Reload the path after that to retry.
+//
+// loadAsync() may be called from any thread; load(), update() and
+// collect() belong to the render thread since they create/destroy GPU
+// resources. All TextureRefs must be released before the registry.
+class TextureRegistry {
+public:
+    explicit TextureRegistry(const TextureRegistryConfig& config = {}) : config(config) {}
+    ~TextureRegistry();
+
+    TextureRegistry(const TextureRegistry&) = delete;
+    TextureRegistry& operator=(const TextureRegistry&) = delete;
+
+    // Blocks until the texture is uploaded (or failed)
+    TextureRef load(const std::string& path);
+    // Returns immediately; the file is read on a worker and uploaded in update()
+    TextureRef loadAsync(const std::string& path);
+
+    // Once per frame: uploads finished async loads, destroys expired textures
+    void update();
+    // Destroys every unreferenced texture now; only safe when the GPU is
+    // idle (e.g. after a level unload and bgfx::frame())
+    void collect();
+
+    size_t getTextureCount() const;
+    size_t getPendingReleaseCount() const;
+    uint64_t getUploadCount() const { return uploads; }
+
+private:
+    friend class TextureRef;
+    using Entry = TextureRegistryEntry;
+
+    TextureRegistryConfig config;
+    mutable std::mutex mutex;
+    // Not a HandlePool: TextureRefs copy and release lock-free on any thread
+    // through a stable Entry*, and the atomics in Entry cannot move. Lookup
+    // is by path at load time only; nothing iterates entries per frame.
+    std::unordered_map<std::string, std::unique_ptr<Entry>> entries;
+    std::vector<Entry*> loading;
+    std::vector<Entry*> releaseQueue;
+    uint64_t frame = 0;
+    uint64_t uploads = 0;
+
+    TextureRef acquire(const std::string& path);
+    void finishLoad(Entry* entry);
+    void release(Entry* entry);
+    void destroyUnreferenced(uint32_t minFrames);
+    static std::string normalizePath(const std::string& path);
+};
+
+} // namespace Engine
@@ -0,0 +1,50 @@
+#include "texture_residency.h"
+#include <algorithm>
+
+namespace Engine {
+
+void TextureResidency::insert(Key key, uint64_t bytes) {
+    erase(key);
+    if (key >= entries.size()) {
+        entries.resize(key + 1);
+    }
+    entries[key] = Entry{bytes, frame, true};
+    usedBytes += bytes;
+    ++entryCount;
+}
+
+void TextureResidency::erase(Key key) {
+    if (!contains(key)) return;
+    usedBytes -= entries[key].bytes;
+    entries[key] = Entry{};
+    --entryCount;
+}
+
+std::vector<TextureResidency::Key> TextureResidency::evict(uint32_t minIdleFrames) {
+    std::vector<Key> evicted;
+    if (usedBytes <= budget) return evicted;
+
+    std::vector<Key> candidates;
+    for (Key key = 0; key < entries.size(); ++key) {
+        const Entry& entry = entries[key];
+        if (entry.resident && frame - entry.lastUsed >= minIdleFrames) {
+            candidates.push_back(key);
+        }
+    }
+    // Oldest first; larger textures first among equally old ones so fewer go.
+    std::sort(candidates.begin(), candidates.end(), [&](Key a, Key b) {
+        if (entries[a].lastUsed != entries[b].lastUsed) return entries[a].lastUsed < entries[b].lastUsed;
+        if (entries[a].bytes != entries[b].bytes) return entries[a].bytes > entries[b].bytes;
+        return a < b;
+    });
+
+    for (Key key : candidates) {
+        if (usedBytes <= budget) break;
+        erase(key);
+        evicted.push_back(key);
+        ++evictions;
+    }
+    return evicted;
+}
+
+} // namespace Engine
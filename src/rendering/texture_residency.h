@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// VRAM-budgeted bookkeeping for resident textures. Tracks estimated sizes
+// and the last frame each texture was drawn; the owner destroys whatever
+// evict() reports. Keys are small dense ids (TextureCache slots).
+class TextureResidency {
+public:
+    using Key = uint32_t;
+
+    explicit TextureResidency(uint64_t budgetBytes = 256ull * 1024 * 1024) : budget(budgetBytes) {}
+
+    void setBudget(uint64_t bytes) { budget = bytes; }
+    uint64_t getBudget() const { return budget; }
+    uint64_t getUsedBytes() const { return usedBytes; }
+    size_t getEntryCount() const { return entryCount; }
+    uint64_t getEvictionCount() const { return evictions; }
+
+    void beginFrame() { ++frame; }
+    uint64_t getFrame() const { return frame; }
+
+    void insert(Key key, uint64_t bytes);  // Stamped with the current frame
+    void markUsed(Key key) {
+        if (key < entries.size()) entries[key].lastUsed = frame;
+    }
+    void erase(Key key);
+    bool contains(Key key) const { return key < entries.size() && entries[key].resident; }
+    uint64_t getLastUsedFrame(Key key) const { return contains(key) ? entries[key].lastUsed : 0; }
+
+    // Evict least recently drawn entries until within budget. Entries drawn
+    // in the last `minIdleFrames` frames may still be referenced by
+    // in-flight draws and are kept even if that leaves the budget exceeded.
+    std::vector<Key> evict(uint32_t minIdleFrames = 1);
+
+private:
+    struct Entry {
+        uint64_t bytes = 0;
+        uint64_t lastUsed = 0;
+        bool resident = false;
+    };
+
+    std::vector<Entry> entries;  // Indexed by key
+    uint64_t budget;
+    uint64_t usedBytes = 0;
+    size_t entryCount = 0;
+    uint64_t evictions = 0;
+    uint64_t frame = 0;
+};
+
+} // namespace Engine
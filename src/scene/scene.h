@@ -5,6 +5,7 @@ namespace Engine {
 
 class Renderer;
 class InputManager;
+struct RenderPacket;
 
 class Scene {
 public:
@@ -18,6 +19,9 @@ public:
     virtual void handleInput(InputManager&, float) {}
     virtual void update(float dt) = 0;
     virtual void render(Renderer& renderer) = 0;
+    // Pipelined rendering (RenderPipeline): record draws into the packet
+    // instead of submitting them. Runs on the simulation thread.
+    virtual void buildRenderPacket(RenderPacket&) {}
 
     void setManager(void* mgr) { manager = mgr; }
 
@@ -1,4 +1,5 @@
 #include "scene_manager.h"
+#include "core/memory_tracker.h"
 
 namespace Engine {
 
@@ -37,6 +38,7 @@ void SceneManager::handleInput(InputManager& input, float dt) {
 
 void SceneManager::update(float dt) {
     if (sceneStack.empty()) return;
+    MemoryTagScope memoryTag(MemoryTag::Scene);
     sceneStack.back()->update(dt);
 }
 
@@ -46,5 +48,11 @@ void SceneManager::render(Renderer& renderer) {
     }
 }
 
+void SceneManager::buildRenderPacket(RenderPacket& packet) {
+    for (auto& scene : sceneStack) {
+        scene->buildRenderPacket(packet);
+    }
+}
+
 } // namespace Engine
 
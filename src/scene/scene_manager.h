@@ -17,6 +17,7 @@ public:
     void update(float dt);
     void handleInput(InputManager& input, float dt);
     void render(Renderer& renderer);
+    void buildRenderPacket(RenderPacket& packet);
 
     bool hasActiveScene() const { return !sceneStack.empty(); }
     size_t getSceneCount() const { return sceneStack.size(); }
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include "audio/audio_command_queue.h"
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+
+AudioCommand makePlay(SoundId sound, VoiceId voice) {
+    AudioCommand command;
+    command.type = AudioCommandType::Play;
+    command.sound = sound;
+    command.voice = voice;
+    return command;
+}
+
+} // namespace
+
+TEST_CASE("AudioCommandQueue capacity rounds up to power of two", "[audioqueue][audio]") {
+    AudioCommandQueue queue(100);
+    REQUIRE(queue.capacity() == 128);
+}
+
+TEST_CASE("AudioCommandQueue preserves FIFO order", "[audioqueue][audio]") {
+    AudioCommandQueue queue(8);
+
+    for (VoiceId i = 1; i <= 5; ++i) {
+        REQUIRE(queue.push(makePlay(0, i)));
+    }
+
+    AudioCommand command;
+    for (VoiceId i = 1; i <= 5; ++i) {
+        REQUIRE(queue.pop(command));
+        REQUIRE(command.voice == i);
+    }
+    REQUIRE_FALSE(queue.pop(command));
+}
+
+TEST_CASE("AudioCommandQueue rejects pushes when full", "[audioqueue][audio]") {
+    AudioCommandQueue queue(4);
+
+    for (VoiceId i = 1; i <= 4; ++i) {
+        REQUIRE(queue.push(makePlay(0, i)));
+    }
+    REQUIRE_FALSE(queue.push(makePlay(0, 5)));
+    REQUIRE(queue.getDroppedCount() == 1);
+
+    SECTION("Space is reusable after draining") {
+        size_t drained = queue.drain([](const AudioCommand&) {});
+        REQUIRE(drained == 4);
+        REQUIRE(queue.push(makePlay(0, 6)));
+    }
+}
+
+TEST_CASE("AudioCommandQueue delivers all commands from multiple producers", "[audioqueue][audio]") {
+    constexpr int kProducers = 4;
+    constexpr VoiceId kPerProducer = 2000;
+    AudioCommandQueue queue(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (VoiceId i = 1; i <= kPerProducer; ++i) {
+                while (!queue.push(makePlay(static_cast<SoundId>(p), i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Consume concurrently; each producer's commands must arrive in order.
+    std::vector<VoiceId> lastSeen(kProducers, 0);
+    size_t received = 0;
+    bool ordered = true;
+    while (received < kProducers * kPerProducer) {
+        AudioCommand command;
+        if (!queue.pop(command)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && command.voice == lastSeen[command.sound] + 1;
+        lastSeen[command.sound] = command.voice;
+        ++received;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(ordered);
+    for (VoiceId last : lastSeen) {
+        REQUIRE(last == kPerProducer);
+    }
+}
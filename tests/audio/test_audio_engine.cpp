@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include "audio/audio_engine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+
+// One second 16-bit mono 440 Hz tone as a RIFF/WAVE file
+std::string writeTestTone(const std::string& name) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / (name + ".wav");
+    const uint32_t sampleRate = 44100;
+    const uint32_t dataBytes = sampleRate * 2;
+
+    auto u16 = [](std::ofstream& out, uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); };
+    auto u32 = [](std::ofstream& out, uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+
+    std::ofstream out(path, std::ios::binary);
+    out.write("RIFF", 4);
+    u32(out, 36 + dataBytes);
+    out.write("WAVEfmt ", 8);
+    u32(out, 16);
+    u16(out, 1);
+    u16(out, 1);
+    u32(out, sampleRate);
+    u32(out, sampleRate * 2);
+    u16(out, 2);
+    u16(out, 16);
+    out.write("data", 4);
+    u32(out, dataBytes);
+    for (uint32_t i = 0; i < sampleRate; ++i) {
+        int16_t sample = static_cast<int16_t>(std::sin(i * 0.0627f) * 8000.0f);
+        out.write(reinterpret_cast<const char*>(&sample), 2);
+    }
+    return path.string();
+}
+
+AudioConfig nullConfig(uint32_t maxVoices = 8) {
+    AudioConfig config;
+    config.backend = AudioBackend::Null;
+    config.sampleRate = 44100;
+    config.bufferSize = 512;
+    config.maxVoices = maxVoices;
+    return config;
+}
+
+float peak(const std::vector<float>& buffer) {
+    float result = 0.0f;
+    for (float s : buffer) result = std::max(result, std::abs(s));
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("AudioEngine null backend mixes offline", "[audioengine][audio]") {
+    AudioEngine audio;
+    REQUIRE(audio.init(nullConfig()));
+    REQUIRE(audio.isOffline());
+    REQUIRE(audio.getSampleRate() == 44100);
+    REQUIRE(audio.getChannels() == 2);
+
+    std::vector<float> buffer(512 * audio.getChannels());
+
+    SECTION("Silence without voices") {
+        REQUIRE(audio.mixOffline(buffer.data(), 512) == 512);
+        REQUIRE(peak(buffer) == 0.0f);
+    }
+
+    SECTION("Playing sound produces signal") {
+        SoundId id = audio.loadSound("tone", writeTestTone("engine_test_tone"));
+        REQUIRE(id != kInvalidSoundId);
+        REQUIRE(audio.playSound(id) != 0);
+
+        audio.mixOffline(buffer.data(), 512);
+        REQUIRE(peak(buffer) > 0.0f);
+    }
+}
+
+TEST_CASE("AudioEngine enforces voice budget", "[audioengine][audio]") {
+    AudioEngine audio;
+    REQUIRE(audio.init(nullConfig(2)));
+    SoundId id = audio.loadSound("tone", writeTestTone("engine_test_budget"));
+
+    audio.playSound(id, 1.0f);
+    audio.playSound(id, 1.0f);
+    audio.playSound(id, 1.0f);
+
+    REQUIRE(audio.getVoiceStats().activeVoices == 2);
+    REQUIRE(audio.getVoiceStats().stolenVoices == 1);
+}
+
+TEST_CASE("AudioEngine applies queued commands on update", "[audioengine][audio]") {
+    AudioEngine audio;
+    REQUIRE(audio.init(nullConfig()));
+    SoundId id = audio.loadSound("tone", writeTestTone("engine_test_queue"));
+
+    VoiceId voice = audio.postPlay(id, 1.0f);
+    REQUIRE(voice != kInvalidVoiceId);
+    REQUIRE(audio.getVoiceStats().activeVoices == 0);
+
+    audio.update();
+    REQUIRE(audio.getVoiceStats().activeVoices == 1);
+
+    audio.postStop(voice);
+    audio.update();
+    REQUIRE(audio.getVoiceStats().activeVoices == 0);
+}
+
+TEST_CASE("AudioEngine prefetches and crossfades music", "[audioengine][audio]") {
+    AudioEngine audio;
+    REQUIRE(audio.init(nullConfig()));
+    audio.loadMusic("a", writeTestTone("engine_test_music_a"));
+    audio.loadMusic("b", writeTestTone("engine_test_music_b"));
+
+    // Requested before the prefetch finished: starts from update()
+    audio.playMusic("a", 1.0f, true);
+    for (int i = 0; i < 1000 && !(audio.isMusicReady("a") && audio.isMusicReady("b")); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        audio.update();
+    }
+    audio.update();
+    REQUIRE(audio.isMusicReady("a"));
+    REQUIRE(audio.isMusicPlaying());
+
+    std::vector<float> buffer(512 * audio.getChannels());
+    audio.playMusic("b", 1.0f, true, 0.05f);
+    audio.mixOffline(buffer.data(), 512);
+    REQUIRE(peak(buffer) > 0.0f);
+
+    // Mix past the fade; the old voice is stopped by the mixer
+    for (int i = 0; i < 8; ++i) audio.mixOffline(buffer.data(), 512);
+    audio.update();
+    REQUIRE(audio.isMusicPlaying());
+    REQUIRE(peak(buffer) > 0.0f);
+
+    audio.stopMusic();
+    REQUIRE_FALSE(audio.isMusicPlaying());
+    audio.mixOffline(buffer.data(), 512);
+    REQUIRE(peak(buffer) == 0.0f);
+}
+
+TEST_CASE("AudioEngine tracks positional voices that start out of range", "[audioengine][audio]") {
+    AudioEngine audio;
+    REQUIRE(audio.init(nullConfig()));
+    SoundId id = audio.loadSound("tone", writeTestTone("engine_test_spatial"));
+
+    audio.setListenerPosition(Vec2(0.0f, 0.0f));
+    const Vec2 farAway(audio.getSpatialSettings().maxDistance * 2.0f, 0.0f);
+    REQUIRE(audio.playSoundAt(id, farAway) != 0);
+    REQUIRE(audio.getVoiceStats().culledVoices == 0);
+
+    audio.update();
+    REQUIRE(audio.getVoiceStats().activeVoices == 1);
+    REQUIRE(audio.getVirtualVoiceCount() == 1);
+
+    audio.setListenerPosition(farAway);
+    audio.update();
+    REQUIRE(audio.getVirtualVoiceCount() == 0);
+}
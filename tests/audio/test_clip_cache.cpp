@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include "audio/clip_cache.h"
+
+using namespace Engine;
+
+TEST_CASE("ClipCache tracks used bytes", "[clipcache][audio]") {
+    ClipCache cache(1000);
+
+    cache.insert(1, 300);
+    cache.insert(2, 200);
+    REQUIRE(cache.getUsedBytes() == 500);
+    REQUIRE(cache.contains(1));
+
+    cache.insert(1, 100);  // Re-insert replaces size
+    REQUIRE(cache.getUsedBytes() == 300);
+
+    cache.erase(2);
+    REQUIRE(cache.getUsedBytes() == 100);
+    REQUIRE_FALSE(cache.contains(2));
+    REQUIRE(cache.getEntryCount() == 1);
+}
+
+TEST_CASE("ClipCache evicts least recently used first", "[clipcache][audio]") {
+    ClipCache cache(250);
+    cache.insert(1, 100);
+    cache.insert(2, 100);
+    cache.insert(3, 100);
+
+    cache.touch(1);  // 2 is now the oldest
+
+    auto evicted = cache.evict([](ClipCache::Key) { return true; });
+
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == 2);
+    REQUIRE(cache.getUsedBytes() == 200);
+    REQUIRE(cache.getEvictionCount() == 1);
+}
+
+TEST_CASE("ClipCache skips pinned entries", "[clipcache][audio]") {
+    ClipCache cache(100);
+    cache.insert(1, 100);
+    cache.insert(2, 100);
+    cache.insert(3, 100);
+
+    // Clip 1 is still playing and must stay resident.
+    auto evicted = cache.evict([](ClipCache::Key key) { return key != 1; });
+
+    REQUIRE(evicted.size() == 2);
+    REQUIRE(cache.contains(1));
+    REQUIRE(cache.getUsedBytes() == 100);
+}
+
+TEST_CASE("ClipCache shrinking budget evicts", "[clipcache][audio]") {
+    ClipCache cache(1000);
+    cache.insert(1, 400);
+    cache.insert(2, 400);
+
+    REQUIRE(cache.evict([](ClipCache::Key) { return true; }).empty());
+
+    cache.setBudget(500);
+    auto evicted = cache.evict([](ClipCache::Key) { return true; });
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == 1);
+}
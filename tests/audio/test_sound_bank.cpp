@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include "audio/sound_bank.h"
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+
+struct TestClip {
+    std::string name;
+    uint8_t flags;
+    std::vector<uint8_t> payload;
+};
+
+void appendU16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(static_cast<uint8_t>(v));
+    out.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+void appendU32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+}
+
+// Mirrors tools/pack_sound_bank.py
+std::vector<uint8_t> buildBank(const std::vector<TestClip>& clips, uint32_t version = SoundBank::kVersion) {
+    uint32_t offset = 12;
+    for (const auto& clip : clips) offset += 2 + static_cast<uint32_t>(clip.name.size()) + 1 + 4 + 4;
+
+    std::vector<uint8_t> bytes = {'S', 'B', 'N', 'K'};
+    appendU32(bytes, version);
+    appendU32(bytes, static_cast<uint32_t>(clips.size()));
+    for (const auto& clip : clips) {
+        appendU16(bytes, static_cast<uint16_t>(clip.name.size()));
+        bytes.insert(bytes.end(), clip.name.begin(), clip.name.end());
+        bytes.push_back(clip.flags);
+        appendU32(bytes, offset);
+        appendU32(bytes, static_cast<uint32_t>(clip.payload.size()));
+        offset += static_cast<uint32_t>(clip.payload.size());
+    }
+    for (const auto& clip : clips) {
+        bytes.insert(bytes.end(), clip.payload.begin(), clip.payload.end());
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("SoundBank parses clip table", "[soundbank][audio]") {
+    SoundBank bank;
+    std::vector<uint8_t> bytes = buildBank({
+        {"sfx/jump", SoundClipPreload, {1, 2, 3}},
+        {"music/theme", SoundClipCompressed, {9, 8, 7, 6}},
+        {"sfx/rare", 0, {5}}
+    });
+
+    REQUIRE(bank.loadFromMemory(bytes));
+    REQUIRE(bank.getClipCount() == 3);
+    REQUIRE(bank.getByteSize() == bytes.size());
+
+    const SoundBankClip* jump = bank.findClip("sfx/jump");
+    REQUIRE(jump != nullptr);
+    REQUIRE(jump->isPreload());
+    REQUIRE_FALSE(jump->isCompressed());
+    REQUIRE(jump->size == 3);
+    REQUIRE(bank.getClipData(*jump)[0] == 1);
+    REQUIRE(bank.getClipData(*jump)[2] == 3);
+
+    const SoundBankClip* theme = bank.findClip("music/theme");
+    REQUIRE(theme != nullptr);
+    REQUIRE(theme->isCompressed());
+    REQUIRE(bank.getClipData(*theme)[0] == 9);
+
+    REQUIRE(bank.findClip("missing") == nullptr);
+}
+
+TEST_CASE("SoundBank rejects malformed data", "[soundbank][audio]") {
+    SoundBank bank;
+
+    SECTION("Bad magic") {
+        std::vector<uint8_t> bytes = buildBank({{"a", 0, {1}}});
+        bytes[0] = 'X';
+        REQUIRE_FALSE(bank.loadFromMemory(bytes));
+    }
+
+    SECTION("Unsupported version") {
+        REQUIRE_FALSE(bank.loadFromMemory(buildBank({{"a", 0, {1}}}, 99)));
+    }
+
+    SECTION("Truncated table") {
+        std::vector<uint8_t> bytes = buildBank({{"clip", 0, {1, 2}}});
+        bytes.resize(16);
+        REQUIRE_FALSE(bank.loadFromMemory(bytes));
+    }
+
+    SECTION("Payload out of range") {
+        std::vector<uint8_t> bytes = buildBank({{"clip", 0, {1, 2, 3, 4}}});
+        bytes.resize(bytes.size() - 2);
+        REQUIRE_FALSE(bank.loadFromMemory(bytes));
+    }
+
+    REQUIRE_FALSE(bank.isLoaded());
+    REQUIRE(bank.getClipCount() == 0);
+}
+
+TEST_CASE("SoundBank missing file fails", "[soundbank][audio]") {
+    SoundBank bank;
+    REQUIRE_FALSE(bank.loadFromFile("nonexistent_bank.sbnk"));
+}
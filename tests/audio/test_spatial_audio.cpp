@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "audio/spatial_audio.h"
+#include <vector>
+
+using namespace Engine;
+using Catch::Approx;
+
+namespace {
+
+SpatialSettings testSettings() {
+    SpatialSettings settings;
+    settings.minDistance = 100.0f;
+    settings.maxDistance = 500.0f;
+    settings.rolloff = 1.0f;
+    settings.panDistance = 200.0f;
+    settings.minAudibleGain = 0.05f;
+    return settings;
+}
+
+struct AppliedParams {
+    unsigned int handle;
+    float volume;
+    float pan;
+    bool isVirtual;
+};
+
+} // namespace
+
+TEST_CASE("Spatial params attenuate with distance", "[spatial][audio]") {
+    const SpatialSettings settings = testSettings();
+    const Vec2 listener(0.0f, 0.0f);
+    std::vector<Vec2> positions = {
+        Vec2(50.0f, 0.0f),    // Inside min distance
+        Vec2(0.0f, 300.0f),   // Halfway between min and max
+        Vec2(0.0f, 800.0f),   // Beyond max distance
+    };
+    std::vector<float> gains(positions.size());
+    std::vector<float> pans(positions.size());
+
+    computeSpatialParams(listener, settings, positions.data(), positions.size(), gains.data(), pans.data());
+
+    REQUIRE(gains[0] == Approx(1.0f));
+    REQUIRE(gains[1] == Approx(0.5f));
+    REQUIRE(gains[2] == Approx(0.0f));
+}
+
+TEST_CASE("Spatial params pan by horizontal offset", "[spatial][audio]") {
+    const SpatialSettings settings = testSettings();
+    std::vector<Vec2> positions = {Vec2(-400.0f, 0.0f), Vec2(100.0f, 0.0f), Vec2(0.0f, 50.0f)};
+    std::vector<float> gains(3);
+    std::vector<float> pans(3);
+
+    computeSpatialParams(Vec2(0.0f, 0.0f), settings, positions.data(), 3, gains.data(), pans.data());
+
+    REQUIRE(pans[0] == Approx(-1.0f));
+    REQUIRE(pans[1] == Approx(0.5f));
+    REQUIRE(pans[2] == Approx(0.0f));
+}
+
+TEST_CASE("SpatialVoiceSet applies only changed voices", "[spatial][audio]") {
+    const SpatialSettings settings = testSettings();
+    SpatialVoiceSet voices;
+    voices.add(1, Vec2(0.0f, 0.0f), 1.0f);
+    voices.add(2, Vec2(300.0f, 0.0f), 1.0f);
+
+    std::vector<AppliedParams> applied;
+    auto record = [&applied](unsigned int h, float v, float p, bool virt) {
+        applied.push_back({h, v, p, virt});
+    };
+
+    voices.update(Vec2(0.0f, 0.0f), settings, record);
+    REQUIRE(applied.size() == 2);
+
+    applied.clear();
+    voices.update(Vec2(0.0f, 0.0f), settings, record);
+    REQUIRE(applied.empty());
+
+    voices.setPosition(2, Vec2(200.0f, 0.0f));
+    voices.update(Vec2(0.0f, 0.0f), settings, record);
+    REQUIRE(applied.size() == 1);
+    REQUIRE(applied[0].handle == 2);
+    REQUIRE(applied[0].volume == Approx(0.75f));
+    REQUIRE(applied[0].pan == Approx(1.0f));
+}
+
+TEST_CASE("SpatialVoiceSet virtualizes out-of-range voices", "[spatial][audio]") {
+    const SpatialSettings settings = testSettings();
+    SpatialVoiceSet voices;
+    voices.add(1, Vec2(1000.0f, 0.0f), 1.0f);
+    voices.add(2, Vec2(0.0f, 0.0f), 1.0f);
+
+    std::vector<AppliedParams> applied;
+    voices.update(Vec2(0.0f, 0.0f), settings, [&applied](unsigned int h, float v, float p, bool virt) {
+        applied.push_back({h, v, p, virt});
+    });
+
+    REQUIRE(voices.getVirtualCount() == 1);
+    REQUIRE(applied[0].handle == 1);
+    REQUIRE(applied[0].isVirtual);
+    REQUIRE(applied[0].volume == 0.0f);
+
+    SECTION("Listener moving closer restores the voice") {
+        applied.clear();
+        voices.update(Vec2(900.0f, 0.0f), settings, [&applied](unsigned int h, float v, float p, bool virt) {
+            applied.push_back({h, v, p, virt});
+        });
+        REQUIRE(voices.getVirtualCount() == 1);  // Voice 2 is now out of range instead
+        REQUIRE(applied.size() == 2);
+    }
+}
+
+TEST_CASE("SpatialVoiceSet removal keeps arrays dense", "[spatial][audio]") {
+    SpatialVoiceSet voices;
+    voices.add(1, Vec2(0.0f, 0.0f), 1.0f);
+    voices.add(2, Vec2(0.0f, 0.0f), 1.0f);
+    voices.add(3, Vec2(0.0f, 0.0f), 1.0f);
+
+    voices.remove(1);
+    REQUIRE(voices.size() == 2);
+    REQUIRE_FALSE(voices.contains(1));
+    REQUIRE(voices.contains(3));
+
+    voices.prune([](unsigned int handle) { return handle != 3; });
+    REQUIRE(voices.size() == 1);
+    REQUIRE(voices.contains(2));
+    REQUIRE_FALSE(voices.setPosition(3, Vec2(1.0f, 1.0f)));
+}
@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "audio/voice_pool.h"
+
+using namespace Engine;
+using Catch::Approx;
+
+namespace {
+
+// Admit and register a voice the way AudioEngine does.
+VoiceAdmission playVoice(VoicePool& pool, uint32_t group, float volume, unsigned int handle) {
+    VoiceAdmission admission = pool.admit(group, volume);
+    if (admission.decision == VoiceDecision::Steal) {
+        pool.onVoiceStopped(admission.victim);
+    }
+    if (admission.accepted()) {
+        pool.onVoiceStarted(handle, group, admission.volume);
+    }
+    return admission;
+}
+
+} // namespace
+
+TEST_CASE("VoicePool admits voices under budget", "[voicepool][audio]") {
+    VoicePool pool(4);
+
+    for (unsigned int i = 1; i <= 4; ++i) {
+        REQUIRE(playVoice(pool, VoicePool::kDefaultGroup, 1.0f, i).decision == VoiceDecision::Play);
+    }
+
+    REQUIRE(pool.getActiveCount() == 4);
+    REQUIRE(pool.getStats().activeVoices == 4);
+    REQUIRE(pool.getStats().peakVoices == 4);
+    REQUIRE(pool.getStats().playRequests == 4);
+}
+
+TEST_CASE("VoicePool group limit steals oldest instance", "[voicepool][audio]") {
+    VoicePool pool(32);
+    SoundGroupConfig gunfire;
+    gunfire.maxInstances = 2;
+    uint32_t group = pool.addGroup(gunfire);
+
+    playVoice(pool, group, 1.0f, 10);
+    playVoice(pool, group, 1.0f, 11);
+    VoiceAdmission third = playVoice(pool, group, 1.0f, 12);
+
+    REQUIRE(third.decision == VoiceDecision::Steal);
+    REQUIRE(third.victim == 10);
+    REQUIRE(pool.getGroupVoiceCount(group) == 2);
+    REQUIRE(pool.getStats().stolenVoices == 1);
+}
+
+TEST_CASE("VoicePool group limit rejects when stealing disabled", "[voicepool][audio]") {
+    VoicePool pool(32);
+    SoundGroupConfig ui;
+    ui.maxInstances = 1;
+    ui.stealOldest = false;
+    uint32_t group = pool.addGroup(ui);
+
+    playVoice(pool, group, 1.0f, 1);
+    VoiceAdmission second = playVoice(pool, group, 1.0f, 2);
+
+    REQUIRE(second.decision == VoiceDecision::Reject);
+    REQUIRE(pool.getStats().rejectedVoices == 1);
+    REQUIRE(pool.getActiveCount() == 1);
+}
+
+TEST_CASE("VoicePool global budget uses priority", "[voicepool][audio]") {
+    VoicePool pool(2);
+    SoundGroupConfig ambient;
+    ambient.priority = 0;
+    SoundGroupConfig dialogue;
+    dialogue.priority = 10;
+    uint32_t ambientGroup = pool.addGroup(ambient);
+    uint32_t dialogueGroup = pool.addGroup(dialogue);
+
+    playVoice(pool, ambientGroup, 0.5f, 1);
+    playVoice(pool, dialogueGroup, 1.0f, 2);
+
+    SECTION("Higher priority steals lowest priority voice") {
+        VoiceAdmission admission = playVoice(pool, dialogueGroup, 1.0f, 3);
+        REQUIRE(admission.decision == VoiceDecision::Steal);
+        REQUIRE(admission.victim == 1);
+    }
+
+    SECTION("Lower priority cannot steal") {
+        pool.onVoiceStopped(1);
+        playVoice(pool, dialogueGroup, 1.0f, 3);
+        VoiceAdmission admission = playVoice(pool, ambientGroup, 1.0f, 4);
+        REQUIRE(admission.decision == VoiceDecision::Reject);
+    }
+
+    SECTION("Equal priority steals only quieter voices") {
+        REQUIRE(playVoice(pool, ambientGroup, 0.25f, 3).decision == VoiceDecision::Reject);
+        VoiceAdmission louder = playVoice(pool, ambientGroup, 0.75f, 4);
+        REQUIRE(louder.decision == VoiceDecision::Steal);
+        REQUIRE(louder.victim == 1);
+    }
+}
+
+TEST_CASE("VoicePool culls inaudible requests", "[voicepool][audio]") {
+    VoicePool pool(8);
+    pool.setMinAudibleVolume(0.05f);
+
+    SoundGroupConfig quiet;
+    quiet.volume = 0.1f;
+    uint32_t group = pool.addGroup(quiet);
+
+    VoiceAdmission admission = playVoice(pool, group, 0.4f, 1);
+
+    REQUIRE(admission.decision == VoiceDecision::Cull);
+    REQUIRE(admission.volume == Approx(0.04f));
+    REQUIRE(pool.getActiveCount() == 0);
+    REQUIRE(pool.getStats().culledVoices == 1);
+}
+
+TEST_CASE("VoicePool prunes finished voices", "[voicepool][audio]") {
+    VoicePool pool(8);
+    for (unsigned int i = 1; i <= 5; ++i) {
+        playVoice(pool, VoicePool::kDefaultGroup, 1.0f, i);
+    }
+
+    pool.prune([](unsigned int handle) { return handle % 2 == 0; });
+
+    REQUIRE(pool.getActiveCount() == 2);
+    REQUIRE(pool.getStats().activeVoices == 2);
+    REQUIRE(pool.getStats().peakVoices == 5);
+}
+
+TEST_CASE("VoicePool unknown group falls back to default", "[voicepool][audio]") {
+    VoicePool pool(8);
+
+    REQUIRE(playVoice(pool, 42, 1.0f, 1).decision == VoiceDecision::Play);
+    REQUIRE(pool.getGroupVoiceCount(VoicePool::kDefaultGroup) == 1);
+}
+
+TEST_CASE("VoicePool evaluate does not count requests", "[voicepool][audio]") {
+    VoicePool pool(1);
+    playVoice(pool, VoicePool::kDefaultGroup, 1.0f, 1);
+
+    SoundGroupConfig low;
+    low.priority = -1;
+    const uint32_t group = pool.addGroup(low);
+    REQUIRE(pool.evaluate(group, 1.0f).decision == VoiceDecision::Reject);
+    REQUIRE(pool.getStats().playRequests == 1);
+    REQUIRE(pool.getStats().rejectedVoices == 0);
+
+    // Retry after the finished voice is reclaimed; only the outcome is recorded
+    pool.prune([](unsigned int) { return false; });
+    const VoiceAdmission retry = pool.evaluate(group, 1.0f);
+    pool.recordAdmission(retry);
+    REQUIRE(retry.decision == VoiceDecision::Play);
+    REQUIRE(pool.getStats().playRequests == 2);
+    REQUIRE(pool.getStats().rejectedVoices == 0);
+}
+
+TEST_CASE("VoicePool reports the group of a live voice", "[voicepool][audio]") {
+    VoicePool pool(8);
+    const uint32_t group = pool.addGroup(SoundGroupConfig{});
+    playVoice(pool, group, 1.0f, 7);
+
+    REQUIRE(pool.getVoiceGroup(7) == group);
+    REQUIRE(pool.getVoiceGroup(8) == VoicePool::kDefaultGroup);
+}
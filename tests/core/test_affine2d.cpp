@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/affine2d.h"
+#include "core/transform.h"
+
+using namespace Engine;
+using Catch::Approx;
+
+TEST_CASE("Affine2D default is identity", "[affine2d][core]") {
+    Affine2D affine;
+    Vec2 p = affine.apply(Vec2(3.0f, -4.0f));
+
+    REQUIRE(p.x == Approx(3.0f));
+    REQUIRE(p.y == Approx(-4.0f));
+    REQUIRE(affine.determinant() == Approx(1.0f));
+}
+
+TEST_CASE("Affine2D matches Mat4 from Transform", "[affine2d][core]") {
+    Transform t;
+    t.position = {40.0f, -12.0f};
+    t.scale = {2.0f, 0.5f};
+    t.rotation = 30.0f;
+
+    Mat4 reference = glm::translate(Mat4(1.0f), Vec3(t.position, 0.0f));
+    reference = glm::rotate(reference, toRadians(t.rotation), Vec3(0.0f, 0.0f, 1.0f));
+    reference = glm::scale(reference, Vec3(t.scale, 1.0f));
+
+    const Vec2 points[] = {{0.0f, 0.0f}, {10.0f, 0.0f}, {-3.0f, 7.0f}};
+    for (const Vec2& point : points) {
+        Vec4 expected = reference * Vec4(point, 0.0f, 1.0f);
+        Vec2 actual = t.toAffine().apply(point);
+        REQUIRE(actual.x == Approx(expected.x).margin(0.001f));
+        REQUIRE(actual.y == Approx(expected.y).margin(0.001f));
+    }
+}
+
+TEST_CASE("Affine2D composition and inverse", "[affine2d][core]") {
+    Transform parent;
+    parent.position = {100.0f, 0.0f};
+    parent.rotation = 90.0f;
+
+    Transform child;
+    child.position = {10.0f, 0.0f};
+    child.scale = {3.0f, 3.0f};
+
+    Affine2D combined = parent.toAffine() * child.toAffine();
+    Vec2 p = combined.apply(Vec2(1.0f, 0.0f));
+    Vec2 expected = parent.transformPoint(child.transformPoint(Vec2(1.0f, 0.0f)));
+
+    REQUIRE(p.x == Approx(expected.x).margin(0.001f));
+    REQUIRE(p.y == Approx(expected.y).margin(0.001f));
+    REQUIRE(p.x == Approx(100.0f).margin(0.001f));
+    REQUIRE(p.y == Approx(13.0f).margin(0.001f));
+
+    Vec2 back = combined.inverse().apply(p);
+    REQUIRE(back.x == Approx(1.0f).margin(0.001f));
+    REQUIRE(back.y == Approx(0.0f).margin(0.001f));
+    REQUIRE(combined * combined.inverse() == Affine2D{});
+}
+
+TEST_CASE("Affine2D singular inverse falls back to identity", "[affine2d][core]") {
+    Affine2D flat = Affine2D::fromTRS(Vec2(5.0f, 5.0f), 0.0f, 1.0f, Vec2(0.0f, 1.0f));
+    REQUIRE(flat.inverse() == Affine2D{});
+}
+
+TEST_CASE("Transform affine follows rotation changes", "[affine2d][transform][core]") {
+    Transform t;
+    Vec2 p = t.toAffine().apply(Vec2(1.0f, 0.0f));
+    REQUIRE(p.x == Approx(1.0f));
+
+    t.rotation = 90.0f;
+    p = t.toAffine().apply(Vec2(1.0f, 0.0f));
+    REQUIRE(p.x == Approx(0.0f).margin(0.001f));
+    REQUIRE(p.y == Approx(1.0f).margin(0.001f));
+
+    Transform copy = t;
+    copy.rotation = 180.0f;
+    p = copy.toAffine().apply(Vec2(1.0f, 0.0f));
+    REQUIRE(p.x == Approx(-1.0f).margin(0.001f));
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/frame_allocator.h"
+#include <cstdint>
+
+using namespace Engine;
+
+TEST_CASE("FrameAllocator bumps aligned allocations", "[frameallocator][core]") {
+    FrameAllocator arena(1024);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(16, 16);
+    REQUIRE(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(c) % 16 == 0);
+    REQUIRE(static_cast<std::byte*>(b) > static_cast<std::byte*>(a));
+    REQUIRE(arena.getUsedBytes() == 32);
+    REQUIRE(arena.getOverflowCount() == 0);
+
+    struct Point { float x, y; };
+    Point* p = arena.create<Point>(Point{1.0f, 2.0f});
+    REQUIRE(p->y == 2.0f);
+}
+
+TEST_CASE("FrameAllocator keeps the previous frame alive", "[frameallocator][core]") {
+    FrameAllocator arena(256);
+
+    int* frame0 = arena.allocateArray<int>(4);
+    frame0[3] = 42;
+    arena.beginFrame();
+    REQUIRE(arena.getUsedBytes() == 0);
+    REQUIRE(arena.getLastFrameBytes() == 4 * sizeof(int));
+
+    int* frame1 = arena.allocateArray<int>(4);
+    REQUIRE(frame1 != frame0);
+    REQUIRE(frame0[3] == 42);  // Other buffer, untouched
+
+    arena.beginFrame();
+    int* frame2 = arena.allocateArray<int>(4);
+    REQUIRE(frame2 == frame0);  // Buffer reused two frames later
+    REQUIRE(arena.getFrameCount() == 2);
+}
+
+TEST_CASE("FrameAllocator overflows to the heap and grows on reset", "[frameallocator][core]") {
+    FrameAllocator arena(64);
+
+    void* small = arena.allocate(48);
+    void* large = arena.allocate(100, 32);
+    REQUIRE(small != nullptr);
+    REQUIRE(reinterpret_cast<uintptr_t>(large) % 32 == 0);
+    REQUIRE(arena.getOverflowCount() == 1);
+    REQUIRE(arena.getPeakBytes() >= 148);
+
+    arena.beginFrame();
+    arena.beginFrame();  // Back on the overflowed buffer
+    REQUIRE(arena.getCapacity() >= 148);
+
+    arena.allocate(48);
+    arena.allocate(100);
+    REQUIRE(arena.getOverflowCount() == 1);
+}
+
+TEST_CASE("FrameVector allocates from the arena", "[frameallocator][core]") {
+    FrameAllocator arena(4096);
+
+    auto values = makeFrameVector<int>(arena, 16);
+    REQUIRE(arena.getUsedBytes() == 16 * sizeof(int));
+    for (int i = 0; i < 16; ++i) {
+        values.push_back(i);
+    }
+    REQUIRE(arena.getUsedBytes() == 16 * sizeof(int));  // No regrowth
+
+    values.push_back(16);  // Regrowth bumps again; the old block is simply abandoned
+    REQUIRE(arena.getUsedBytes() > 16 * sizeof(int));
+    REQUIRE(values.back() == 16);
+    REQUIRE(values[5] == 5);
+
+    FrameVector<int> copy = values;
+    REQUIRE(copy.get_allocator() == values.get_allocator());
+    REQUIRE(copy.size() == 17);
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/handle_pool.h"
+#include <string>
+
+using namespace Engine;
+
+TEST_CASE("HandlePool creates and resolves handles", "[handlepool][core]") {
+    HandlePool<std::string> pool;
+    REQUIRE_FALSE(HandlePool<std::string>::Handle{}.isValid());
+
+    auto a = pool.create("a");
+    auto b = pool.create("b");
+    REQUIRE(a.isValid());
+    REQUIRE(a != b);
+    REQUIRE(pool.size() == 2);
+    REQUIRE(*pool.get(a) == "a");
+    REQUIRE(*pool.get(b) == "b");
+    REQUIRE(pool.get(HandlePool<std::string>::Handle{}) == nullptr);
+}
+
+TEST_CASE("HandlePool rejects stale handles after slot reuse", "[handlepool][core]") {
+    HandlePool<int> pool;
+    auto a = pool.create(1);
+    REQUIRE(pool.destroy(a));
+    REQUIRE_FALSE(pool.destroy(a));
+    REQUIRE_FALSE(pool.contains(a));
+
+    auto b = pool.create(2);
+    REQUIRE(b.index == a.index);  // Slot recycled from the free list
+    REQUIRE(b.generation != a.generation);
+    REQUIRE(pool.get(a) == nullptr);
+    REQUIRE(*pool.get(b) == 2);
+    REQUIRE(pool.getSlotCount() == 1);
+}
+
+TEST_CASE("HandlePool keeps objects dense across destroy", "[handlepool][core]") {
+    HandlePool<int> pool;
+    auto a = pool.create(10);
+    auto b = pool.create(20);
+    auto c = pool.create(30);
+
+    pool.destroy(a);  // Last object moves into the hole
+    REQUIRE(pool.size() == 2);
+    REQUIRE(*pool.get(b) == 20);
+    REQUIRE(*pool.get(c) == 30);
+
+    int sum = 0;
+    for (int value : pool) sum += value;
+    REQUIRE(sum == 50);
+
+    for (size_t i = 0; i < pool.size(); ++i) {
+        REQUIRE(*pool.get(pool.handleAt(i)) == pool[i]);
+    }
+    REQUIRE(pool.getHandle(c.index) == c);
+    REQUIRE_FALSE(pool.getHandle(a.index).isValid());
+}
+
+TEST_CASE("HandlePool clear invalidates outstanding handles", "[handlepool][core]") {
+    HandlePool<int> pool(4);
+    auto a = pool.create(1);
+    auto b = pool.create(2);
+    pool.clear();
+    REQUIRE(pool.empty());
+    REQUIRE_FALSE(pool.contains(a));
+    REQUIRE_FALSE(pool.contains(b));
+
+    auto c = pool.create(3);
+    REQUIRE(c.index < 2);
+    REQUIRE(pool.get(a) == nullptr);
+    REQUIRE(pool.get(b) == nullptr);
+    REQUIRE(*pool.get(c) == 3);
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/listener_list.h"
+#include <vector>
+
+using namespace Engine;
+
+TEST_CASE("ListenerList adds and removes listeners", "[listeners][core]") {
+    ListenerList<int, int> list;
+    std::vector<int> calls;
+
+    const auto a = list.add([&](int w, int) { calls.push_back(w); });
+    const auto b = list.add([&](int, int h) { calls.push_back(h); });
+    REQUIRE(a != 0);
+    REQUIRE(a != b);
+    REQUIRE(list.size() == 2);
+
+    list.dispatch(1, 2);
+    REQUIRE(calls == std::vector<int>{1, 2});
+
+    list.remove(a);
+    list.remove(a);  // Removing twice is harmless
+    REQUIRE(list.size() == 1);
+
+    calls.clear();
+    list.dispatch(3, 4);
+    REQUIRE(calls == std::vector<int>{4});
+
+    list.remove(b);
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("ListenerList tolerates changes during dispatch", "[listeners][core]") {
+    ListenerList<int> list;
+    std::vector<int> calls;
+    ListenerList<int>::Id second = 0;
+
+    SECTION("a listener removes itself") {
+        ListenerList<int>::Id self = 0;
+        self = list.add([&](int v) {
+            calls.push_back(v);
+            list.remove(self);
+        });
+        list.add([&](int v) { calls.push_back(v * 10); });
+
+        list.dispatch(1);
+        list.dispatch(2);
+        REQUIRE(calls == std::vector<int>{1, 10, 20});
+        REQUIRE(list.size() == 1);
+    }
+
+    SECTION("a listener removes a later one") {
+        list.add([&](int v) {
+            calls.push_back(v);
+            list.remove(second);
+        });
+        second = list.add([&](int v) { calls.push_back(v * 10); });
+
+        list.dispatch(1);
+        REQUIRE(calls == std::vector<int>{1});
+        REQUIRE(list.size() == 1);
+    }
+
+    SECTION("a listener added during dispatch runs from the next dispatch") {
+        list.add([&](int v) {
+            calls.push_back(v);
+            if (second == 0) {
+                second = list.add([&](int w) { calls.push_back(w * 10); });
+            }
+        });
+
+        list.dispatch(1);
+        REQUIRE(calls == std::vector<int>{1});
+
+        list.dispatch(2);
+        REQUIRE(calls == std::vector<int>{1, 2, 20});
+    }
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/memory_tracker.h"
+#include <string>
+
+using namespace Engine;
+
+TEST_CASE("MemoryTracker tracks live and peak bytes per tag", "[memorytracker][core]") {
+    MemoryTracker tracker;
+    tracker.recordAllocation(MemoryTag::Audio, 100);
+    tracker.recordAllocation(MemoryTag::Audio, 50);
+    tracker.recordFree(MemoryTag::Audio, 100);
+    tracker.recordAllocation(MemoryTag::Rendering, 8);
+
+    const MemoryTagStats audio = tracker.getStats(MemoryTag::Audio);
+    REQUIRE(audio.liveBytes == 50);
+    REQUIRE(audio.peakBytes == 150);
+    REQUIRE(audio.liveAllocations == 1);
+    REQUIRE(audio.totalAllocations == 2);
+    REQUIRE(tracker.getStats(MemoryTag::Rendering).liveBytes == 8);
+    REQUIRE(tracker.getStats(MemoryTag::Assets).totalAllocations == 0);
+    REQUIRE(tracker.getTotalLiveBytes() == 58);
+}
+
+TEST_CASE("MemoryTracker reports per-frame counters after endFrame", "[memorytracker][core]") {
+    MemoryTracker tracker;
+    tracker.recordAllocation(MemoryTag::Scene, 16);
+    tracker.recordAllocation(MemoryTag::Scene, 16);
+    REQUIRE(tracker.getStats(MemoryTag::Scene).frameAllocations == 0);  // Frame still open
+
+    tracker.endFrame();
+    REQUIRE(tracker.getStats(MemoryTag::Scene).frameAllocations == 2);
+    REQUIRE(tracker.getStats(MemoryTag::Scene).frameBytes == 32);
+
+    tracker.endFrame();
+    REQUIRE(tracker.getStats(MemoryTag::Scene).frameAllocations == 0);
+    REQUIRE(tracker.getStats(MemoryTag::Scene).liveBytes == 32);
+    REQUIRE(tracker.getFrameCount() == 2);
+}
+
+TEST_CASE("MemoryTracker flags spikes only after warmup", "[memorytracker][core]") {
+    MemoryTrackerConfig config;
+    config.warmupFrames = 2;
+    config.spikeAllocationsPerFrame = 3;
+    config.spikeBytesPerFrame = 1000;
+    MemoryTracker tracker(config);
+
+    auto allocate = [&](int count, size_t bytes) {
+        for (int i = 0; i < count; ++i) tracker.recordAllocation(MemoryTag::Animation, bytes);
+    };
+
+    allocate(10, 1);  // Loading
+    tracker.endFrame();
+    tracker.endFrame();
+    REQUIRE(tracker.getSpikeCount() == 0);
+
+    allocate(2, 1);
+    tracker.endFrame();
+    REQUIRE(tracker.getSpikeCount() == 0);
+
+    allocate(4, 1);  // Count threshold
+    tracker.endFrame();
+    REQUIRE(tracker.getSpikeCount() == 1);
+
+    allocate(1, 2000);  // Byte threshold
+    tracker.endFrame();
+    REQUIRE(tracker.getSpikeCount() == 2);
+}
+
+TEST_CASE("MemoryTracker budgets are kept per tag", "[memorytracker][core]") {
+    MemoryTracker tracker;
+    tracker.setBudget(MemoryTag::Assets, 64);
+    tracker.recordAllocation(MemoryTag::Assets, 128);
+    tracker.recordAllocation(MemoryTag::Audio, 128);
+    tracker.endFrame();
+    REQUIRE(tracker.getStats(MemoryTag::Assets).overBudget);
+    REQUIRE_FALSE(tracker.getStats(MemoryTag::Audio).overBudget);  // No budget set
+
+    tracker.recordFree(MemoryTag::Assets, 128);
+    tracker.endFrame();
+    REQUIRE_FALSE(tracker.getStats(MemoryTag::Assets).overBudget);
+}
+
+TEST_CASE("MemoryTagScope restores the previous tag", "[memorytracker][core]") {
+    REQUIRE(MemoryTracker::getCurrentTag() == MemoryTag::General);
+    {
+        MemoryTagScope outer(MemoryTag::Rendering);
+        {
+            MemoryTagScope inner(MemoryTag::Assets);
+            REQUIRE(MemoryTracker::getCurrentTag() == MemoryTag::Assets);
+        }
+        REQUIRE(MemoryTracker::getCurrentTag() == MemoryTag::Rendering);
+    }
+    REQUIRE(MemoryTracker::getCurrentTag() == MemoryTag::General);
+    REQUIRE(std::string(toString(MemoryTag::Audio)) == "Audio");
+}
@@ -2,6 +2,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "core/transform.h"
+#include <type_traits>
 
 using namespace Engine;
 
@@ -70,4 +71,14 @@ TEST_CASE("Transform to matrix", "[transform][core]") {
     
     REQUIRE_THAT(transformed.x, Catch::Matchers::WithinRel(50.0f, 0.01f));
     REQUIRE_THAT(transformed.y, Catch::Matchers::WithinRel(100.0f, 0.01f));
-}
\ No newline at end of file
+}
+TEST_CASE("Transform stays a plain aggregate", "[transform][core]") {
+    // Shared across worker threads and stored in dense arrays
+    STATIC_REQUIRE(std::is_aggregate_v<Transform>);
+    STATIC_REQUIRE(sizeof(Transform) == 6 * sizeof(float));
+
+    const Transform t{Vec2(1.0f, 2.0f), Vec2(2.0f, 2.0f), 90.0f};
+    const Vec2 transformed = t.toAffine().apply(Vec2(1.0f, 0.0f));
+    REQUIRE_THAT(transformed.x, Catch::Matchers::WithinAbs(1.0f, 1e-5));
+    REQUIRE_THAT(transformed.y, Catch::Matchers::WithinAbs(4.0f, 1e-5));
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/transform_batch.h"
+#include <cmath>
+#include <vector>
+
+using namespace Engine;
+using Catch::Approx;
+
+namespace {
+
+Transform rotatedTransform() {
+    Transform t;
+    t.position = {50.0f, -20.0f};
+    t.rotation = 30.0f;
+    t.scale = {2.0f, 0.5f};
+    return t;
+}
+
+} // namespace
+
+TEST_CASE("transformPoints matches Transform::transformPoint", "[transformbatch][core]") {
+    const Transform t = rotatedTransform();
+    // Odd count exercises the scalar tail after the paired SIMD loop
+    std::vector<Vec2> points = {{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {-3.5f, 7.25f}, {100.0f, -40.0f}};
+    std::vector<Vec2> out(points.size());
+
+    transformPoints(t, points, out);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        Vec2 expected = t.transformPoint(points[i]);
+        REQUIRE(out[i].x == Approx(expected.x).margin(0.001f));
+        REQUIRE(out[i].y == Approx(expected.y).margin(0.001f));
+    }
+
+    SECTION("In place") {
+        std::vector<Vec2> inPlace = points;
+        transformPoints(t, inPlace, inPlace);
+        for (size_t i = 0; i < points.size(); ++i) {
+            REQUIRE(inPlace[i].x == Approx(out[i].x));
+            REQUIRE(inPlace[i].y == Approx(out[i].y));
+        }
+    }
+
+    SECTION("Shorter output limits the count") {
+        std::vector<Vec2> small(2, Vec2(-1.0f, -1.0f));
+        transformPoints(t, points, small);
+        REQUIRE(small[1].x == Approx(out[1].x));
+    }
+}
+
+TEST_CASE("transformPoints with one transform per point", "[transformbatch][core]") {
+    std::vector<Transform> transforms(3);
+    transforms[0].position = {1.0f, 0.0f};
+    transforms[1].rotation = 90.0f;
+    transforms[2].scale = {3.0f, 3.0f};
+
+    std::vector<Affine2D> affines(transforms.size());
+    toAffines(transforms, affines);
+
+    std::vector<Vec2> points(3, Vec2(1.0f, 0.0f));
+    std::vector<Vec2> out(3);
+    transformPoints(affines, points, out);
+
+    REQUIRE(out[0].x == Approx(2.0f));
+    REQUIRE(out[1].x == Approx(0.0f).margin(0.001f));
+    REQUIRE(out[1].y == Approx(1.0f));
+    REQUIRE(out[2].x == Approx(3.0f));
+}
+
+TEST_CASE("computeWorldBounds covers rotated rectangles tightly", "[transformbatch][core]") {
+    Transform t;
+    t.position = {100.0f, 100.0f};
+    t.rotation = 45.0f;
+
+    // 10x10 square centred on the origin, rotated 45 degrees
+    Rectangle bounds = computeWorldBounds(t.toAffine(), Rectangle(-5.0f, -5.0f, 10.0f, 10.0f));
+    const float halfDiagonal = 5.0f * std::sqrt(2.0f);
+    REQUIRE(bounds.x == Approx(100.0f - halfDiagonal));
+    REQUIRE(bounds.y == Approx(100.0f - halfDiagonal));
+    REQUIRE(bounds.width == Approx(halfDiagonal * 2.0f));
+
+    // Same result as transforming the corners
+    const Transform r = rotatedTransform();
+    const Rectangle local(-4.0f, -2.0f, 16.0f, 8.0f);
+    std::vector<Vec2> corners = {{local.left(), local.top()}, {local.right(), local.top()},
+                                 {local.right(), local.bottom()}, {local.left(), local.bottom()}};
+    transformPoints(r, corners, corners);
+    Rectangle expected = computePointBounds(corners);
+
+    std::vector<Affine2D> affines = {r.toAffine()};
+    std::vector<Rectangle> locals = {local};
+    std::vector<Rectangle> out(1);
+    computeWorldBounds(affines, locals, out);
+
+    REQUIRE(out[0].x == Approx(expected.x));
+    REQUIRE(out[0].y == Approx(expected.y));
+    REQUIRE(out[0].width == Approx(expected.width));
+    REQUIRE(out[0].height == Approx(expected.height));
+}
+
+TEST_CASE("computePointBounds", "[transformbatch][core]") {
+    REQUIRE(computePointBounds({}).isEmpty());
+
+    std::vector<Vec2> points = {{3.0f, -1.0f}, {-2.0f, 4.0f}, {0.0f, 0.0f}};
+    Rectangle bounds = computePointBounds(points);
+    REQUIRE(bounds.x == Approx(-2.0f));
+    REQUIRE(bounds.y == Approx(-1.0f));
+    REQUIRE(bounds.width == Approx(5.0f));
+    REQUIRE(bounds.height == Approx(5.0f));
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/transform_hierarchy.h"
+
+using namespace Engine;
+using Catch::Approx;
+
+namespace {
+
+Transform makeTransform(const Vec2& position, float rotation = 0.0f, const Vec2& scale = Vec2(1.0f, 1.0f)) {
+    Transform t;
+    t.position = position;
+    t.rotation = rotation;
+    t.scale = scale;
+    return t;
+}
+
+} // namespace
+
+TEST_CASE("TransformHierarchy roots use their local transform", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId root = hierarchy.create(makeTransform({10.0f, 20.0f}));
+    hierarchy.update();
+
+    REQUIRE(hierarchy.isValid(root));
+    REQUIRE(hierarchy.size() == 1);
+    REQUIRE(hierarchy.getWorldPosition(root).x == Approx(10.0f));
+    REQUIRE(hierarchy.getWorldPosition(root).y == Approx(20.0f));
+}
+
+TEST_CASE("TransformHierarchy children follow rotated and scaled parents", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId parent = hierarchy.create(makeTransform({100.0f, 0.0f}, 90.0f, {2.0f, 2.0f}));
+    TransformNodeId child = hierarchy.create(makeTransform({10.0f, 0.0f}, 0.0f), parent);
+    hierarchy.update();
+
+    // Child offset is rotated by 90 degrees and doubled
+    Vec2 position = hierarchy.getWorldPosition(child);
+    REQUIRE(position.x == Approx(100.0f).margin(0.001f));
+    REQUIRE(position.y == Approx(20.0f).margin(0.001f));
+
+    Transform world = hierarchy.getWorldTransform(child);
+    REQUIRE(world.rotation == Approx(90.0f));
+    REQUIRE(world.scale.x == Approx(2.0f));
+    REQUIRE(world.scale.y == Approx(2.0f));
+}
+
+TEST_CASE("TransformHierarchy recomputes only dirty subtrees", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId a = hierarchy.create(makeTransform({0.0f, 0.0f}));
+    TransformNodeId aChild = hierarchy.create(makeTransform({1.0f, 0.0f}), a);
+    TransformNodeId aGrandchild = hierarchy.create(makeTransform({1.0f, 0.0f}), aChild);
+    TransformNodeId b = hierarchy.create(makeTransform({50.0f, 0.0f}));
+    hierarchy.create(makeTransform({1.0f, 0.0f}), b);
+    hierarchy.update();
+    REQUIRE(hierarchy.getLastUpdatedCount() == 5);
+
+    hierarchy.update();
+    REQUIRE(hierarchy.getLastUpdatedCount() == 0);
+
+    hierarchy.setLocalPosition(aChild, {5.0f, 0.0f});
+    hierarchy.update();
+    REQUIRE(hierarchy.getLastUpdatedCount() == 2);
+    REQUIRE(hierarchy.getWorldPosition(aGrandchild).x == Approx(6.0f));
+
+    hierarchy.setLocalRotation(a, 180.0f);
+    hierarchy.update();
+    REQUIRE(hierarchy.getLastUpdatedCount() == 3);
+    REQUIRE(hierarchy.getWorldPosition(aGrandchild).x == Approx(-6.0f).margin(0.001f));
+}
+
+TEST_CASE("TransformHierarchy reparenting", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId a = hierarchy.create(makeTransform({100.0f, 0.0f}));
+    TransformNodeId b = hierarchy.create(makeTransform({0.0f, 100.0f}));
+    TransformNodeId child = hierarchy.create(makeTransform({1.0f, 1.0f}), a);
+    hierarchy.update();
+    REQUIRE(hierarchy.getWorldPosition(child).x == Approx(101.0f));
+
+    SECTION("Moves to the new parent") {
+        REQUIRE(hierarchy.setParent(child, b));
+        hierarchy.update();
+        REQUIRE(hierarchy.getParent(child) == b);
+        REQUIRE(hierarchy.getWorldPosition(child).x == Approx(1.0f));
+        REQUIRE(hierarchy.getWorldPosition(child).y == Approx(101.0f));
+
+        // Old parent no longer drives it
+        hierarchy.setLocalPosition(a, {500.0f, 0.0f});
+        hierarchy.update();
+        REQUIRE(hierarchy.getWorldPosition(child).x == Approx(1.0f));
+    }
+
+    SECTION("Detaches to a root") {
+        REQUIRE(hierarchy.setParent(child, kInvalidTransformNode));
+        hierarchy.update();
+        REQUIRE(hierarchy.getWorldPosition(child).x == Approx(1.0f));
+    }
+
+    SECTION("Rejects cycles") {
+        REQUIRE_FALSE(hierarchy.setParent(a, child));
+        REQUIRE_FALSE(hierarchy.setParent(a, a));
+        REQUIRE(hierarchy.getParent(a) == kInvalidTransformNode);
+    }
+}
+
+TEST_CASE("TransformHierarchy destroy removes the subtree", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId root = hierarchy.create(makeTransform({0.0f, 0.0f}));
+    TransformNodeId child = hierarchy.create(makeTransform({1.0f, 0.0f}), root);
+    TransformNodeId grandchild = hierarchy.create(makeTransform({1.0f, 0.0f}), child);
+    TransformNodeId other = hierarchy.create(makeTransform({7.0f, 0.0f}));
+    hierarchy.update();
+
+    hierarchy.destroy(child);
+    hierarchy.update();
+
+    REQUIRE(hierarchy.size() == 2);
+    REQUIRE_FALSE(hierarchy.isValid(child));
+    REQUIRE_FALSE(hierarchy.isValid(grandchild));
+    REQUIRE(hierarchy.isValid(root));
+    REQUIRE(hierarchy.getWorldPosition(other).x == Approx(7.0f));
+
+    // Ids are recycled
+    TransformNodeId reused = hierarchy.create(makeTransform({3.0f, 0.0f}), other);
+    hierarchy.update();
+    REQUIRE(hierarchy.isValid(reused));
+    REQUIRE(hierarchy.getWorldPosition(reused).x == Approx(10.0f));
+}
+
+TEST_CASE("TransformHierarchy getters return identity for invalid ids", "[transformhierarchy][core]") {
+    TransformHierarchy hierarchy;
+    TransformNodeId node = hierarchy.create(makeTransform({5.0f, 2.0f}, 30.0f));
+    hierarchy.update();
+    hierarchy.destroy(node);
+    hierarchy.update();
+
+    for (TransformNodeId id : {node, TransformNodeId(42), kInvalidTransformNode}) {
+        REQUIRE(hierarchy.getLocal(id).position.x == 0.0f);
+        REQUIRE(hierarchy.getLocal(id).scale.x == 1.0f);
+        REQUIRE(hierarchy.getWorld(id).a == 1.0f);
+        REQUIRE(hierarchy.getWorldPosition(id).x == 0.0f);
+        REQUIRE(hierarchy.getWorldTransform(id).rotation == 0.0f);
+        REQUIRE(hierarchy.getWorldTransform(id).scale.y == 1.0f);
+    }
+}
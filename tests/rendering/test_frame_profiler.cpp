@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "rendering/frame_profiler.h"
+#include <cstring>
+
+using namespace Engine;
+using Catch::Approx;
+
+namespace {
+
+FrameTimings makeFrame(float cpuMs, float gpuMs) {
+    FrameTimings timings;
+    timings.frameMs = cpuMs;
+    timings.cpuMs = cpuMs;
+    timings.gpuMs = gpuMs;
+    return timings;
+}
+
+} // namespace
+
+TEST_CASE("RollingHistory keeps the most recent values", "[frameprofiler][rendering]") {
+    RollingHistory history(3);
+    REQUIRE(history.empty());
+    REQUIRE(history.average() == 0.0f);
+
+    history.push(1.0f);
+    history.push(2.0f);
+    REQUIRE(history.size() == 2);
+    REQUIRE(history.latest() == 2.0f);
+    REQUIRE(history.average() == Approx(1.5f));
+
+    history.push(3.0f);
+    history.push(10.0f);  // Overwrites 1
+    REQUIRE(history.size() == 3);
+    REQUIRE(history.latest() == 10.0f);
+    REQUIRE(history.at(2) == 2.0f);
+    REQUIRE(history.at(3) == 0.0f);
+    REQUIRE(history.min() == 2.0f);
+    REQUIRE(history.max() == 10.0f);
+    REQUIRE(history.average() == Approx(5.0f));
+
+    history.clear();
+    REQUIRE(history.empty());
+}
+
+TEST_CASE("FrameTimings converts bgfx stats to milliseconds", "[frameprofiler][rendering]") {
+    bgfx::ViewStats views[2]{};
+    std::strcpy(views[0].name, "world");
+    views[0].view = 0;
+    views[0].cpuTimeBegin = 0;
+    views[0].cpuTimeEnd = 2000;
+    views[0].gpuTimeBegin = 100;
+    views[0].gpuTimeEnd = 400;
+    views[1].view = 3;
+    views[1].gpuTimeEnd = 1000;
+
+    bgfx::Stats stats{};
+    stats.cpuTimerFreq = 1000000;  // Microsecond ticks
+    stats.gpuTimerFreq = 100000;
+    stats.cpuTimeFrame = 16000;
+    stats.waitRender = 4000;
+    stats.waitSubmit = 500;
+    stats.cpuTimeBegin = 1000;
+    stats.cpuTimeEnd = 3000;
+    stats.gpuTimeBegin = 0;
+    stats.gpuTimeEnd = 1200;
+    stats.numViews = 2;
+    stats.viewStats = views;
+
+    const FrameTimings timings = FrameTimings::fromStats(stats);
+    REQUIRE(timings.frameMs == Approx(16.0f));
+    REQUIRE(timings.waitRenderMs == Approx(4.0f));
+    REQUIRE(timings.waitSubmitMs == Approx(0.5f));
+    REQUIRE(timings.cpuMs == Approx(12.0f));
+    REQUIRE(timings.submitMs == Approx(2.0f));
+    REQUIRE(timings.gpuMs == Approx(12.0f));
+    REQUIRE(timings.views.size() == 2);
+    REQUIRE(timings.views[0].name == "world");
+    REQUIRE(timings.views[0].cpuMs == Approx(2.0f));
+    REQUIRE(timings.views[0].gpuMs == Approx(3.0f));
+    REQUIRE(timings.views[1].view == 3);
+    REQUIRE(timings.views[1].gpuMs == Approx(10.0f));
+}
+
+TEST_CASE("FrameTimings tolerates missing timer frequencies", "[frameprofiler][rendering]") {
+    bgfx::Stats stats{};
+    stats.cpuTimeFrame = 1000;
+    const FrameTimings timings = FrameTimings::fromStats(stats);
+    REQUIRE(timings.frameMs == 0.0f);
+    REQUIRE(timings.gpuMs == 0.0f);
+    REQUIRE(timings.views.empty());
+}
+
+TEST_CASE("FrameProfiler tracks per-view histories", "[frameprofiler][rendering]") {
+    FrameProfiler profiler(4);
+
+    FrameTimings frame = makeFrame(10.0f, 5.0f);
+    frame.views.push_back({2, "ui", 0.5f, 1.0f});
+    frame.views.push_back({0, "world", 1.0f, 4.0f});
+    profiler.addFrame(frame);
+
+    frame.views[0].gpuMs = 3.0f;
+    frame.views[1].name.clear();  // Name is kept from earlier frames
+    profiler.addFrame(frame);
+
+    REQUIRE(profiler.getViews().size() == 2);
+    REQUIRE(profiler.getViews()[0].view == 0);
+    REQUIRE(profiler.getViews()[1].view == 2);
+
+    const FrameProfiler::ViewHistory* ui = profiler.findView(2);
+    REQUIRE(ui != nullptr);
+    REQUIRE(ui->name == "ui");
+    REQUIRE(ui->gpu.average() == Approx(2.0f));
+    REQUIRE(profiler.findView(0)->name == "world");
+    REQUIRE(profiler.findView(1) == nullptr);
+
+    REQUIRE(profiler.getFrameHistory().size() == 2);
+    REQUIRE(profiler.getLastFrame().views[0].gpuMs == 3.0f);
+
+    profiler.clear();
+    REQUIRE(profiler.getViews().empty());
+    REQUIRE(profiler.getCpuHistory().empty());
+}
+
+TEST_CASE("FrameProfiler classifies CPU- and GPU-bound frames", "[frameprofiler][rendering]") {
+    FrameProfiler profiler(8);
+    REQUIRE(profiler.getBound() == FrameBound::Unknown);
+
+    SECTION("No GPU timings") {
+        profiler.addFrame(makeFrame(16.0f, 0.0f));
+        REQUIRE(profiler.getBound() == FrameBound::Unknown);
+    }
+
+    SECTION("GPU-bound") {
+        profiler.addFrame(makeFrame(4.0f, 14.0f));
+        REQUIRE(profiler.getBound() == FrameBound::Gpu);
+    }
+
+    SECTION("CPU-bound") {
+        profiler.addFrame(makeFrame(14.0f, 4.0f));
+        REQUIRE(profiler.getBound() == FrameBound::Cpu);
+    }
+
+    SECTION("Within the margin") {
+        profiler.addFrame(makeFrame(10.0f, 10.5f));
+        REQUIRE(profiler.getBound() == FrameBound::Balanced);
+        REQUIRE(std::string(toString(profiler.getBound())) == "Balanced");
+    }
+}
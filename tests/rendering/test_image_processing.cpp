@@ -0,0 +1,138 @@
+#include <catch2/catch_test_macros.hpp>
+#include "rendering/image_processing.h"
+#include <cmath>
+
+using namespace Engine;
+
+namespace {
+
+std::vector<uint8_t> makePattern(size_t bytes) {
+    std::vector<uint8_t> data(bytes);
+    uint32_t state = 12345;
+    for (uint8_t& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("expandRGBToRGBA adds opaque alpha", "[image][rendering]") {
+    // 7 pixels covers the vector loop and the scalar tail
+    const std::vector<uint8_t> rgb = makePattern(7 * 3);
+    std::vector<uint8_t> rgba(7 * 4, 0);
+
+    expandRGBToRGBA(rgb, rgba);
+
+    for (size_t i = 0; i < 7; ++i) {
+        REQUIRE(rgba[i * 4 + 0] == rgb[i * 3 + 0]);
+        REQUIRE(rgba[i * 4 + 1] == rgb[i * 3 + 1]);
+        REQUIRE(rgba[i * 4 + 2] == rgb[i * 3 + 2]);
+        REQUIRE(rgba[i * 4 + 3] == 255);
+    }
+}
+
+TEST_CASE("premultiplyAlpha rounds exactly and keeps alpha", "[image][rendering]") {
+    std::vector<uint8_t> rgba = makePattern(13 * 4);
+    rgba[3] = 0;
+    rgba[7] = 255;
+    const std::vector<uint8_t> original = rgba;
+
+    premultiplyAlpha(rgba);
+
+    for (size_t i = 0; i < 13; ++i) {
+        const int alpha = original[i * 4 + 3];
+        for (int c = 0; c < 3; ++c) {
+            const int expected = static_cast<int>(std::lround(original[i * 4 + c] * alpha / 255.0));
+            REQUIRE(rgba[i * 4 + c] == expected);
+        }
+        REQUIRE(rgba[i * 4 + 3] == alpha);
+    }
+    REQUIRE(rgba[0] == 0);
+    REQUIRE(rgba[4] == original[4]);
+}
+
+TEST_CASE("premultiplyAlpha matches across the threaded path", "[image][rendering]") {
+    const size_t pixels = kParallelPixelThreshold + 3;
+    std::vector<uint8_t> rgba = makePattern(pixels * 4);
+    const std::vector<uint8_t> original = rgba;
+
+    premultiplyAlpha(rgba);
+
+    for (size_t i = 0; i < pixels; i += 997) {
+        const int alpha = original[i * 4 + 3];
+        const int expected = static_cast<int>(std::lround(original[i * 4] * alpha / 255.0));
+        REQUIRE(rgba[i * 4] == expected);
+    }
+    const size_t last = pixels - 1;
+    REQUIRE(rgba[last * 4 + 1] == std::lround(original[last * 4 + 1] * original[last * 4 + 3] / 255.0));
+}
+
+TEST_CASE("sRGB conversions follow the transfer curve", "[image][rendering]") {
+    std::vector<uint8_t> rgba = {0, 128, 255, 77};
+
+    srgbToLinear(rgba);
+    REQUIRE(rgba[0] == 0);
+    REQUIRE(rgba[1] == 55);  // 0.2158 * 255
+    REQUIRE(rgba[2] == 255);
+    REQUIRE(rgba[3] == 77);
+
+    linearToSrgb(rgba);
+    REQUIRE(rgba[0] == 0);
+    REQUIRE(std::abs(rgba[1] - 128) <= 1);
+    REQUIRE(rgba[2] == 255);
+    REQUIRE(rgba[3] == 77);
+}
+
+TEST_CASE("downsampleBox averages 2x2 blocks", "[image][rendering]") {
+    const uint32_t width = 11;  // Odd: last column repeats
+    const uint32_t height = 5;
+    const std::vector<uint8_t> src = makePattern(width * height * 4);
+    std::vector<uint8_t> dst(5 * 2 * 4);
+
+    downsampleBox(src.data(), width, height, dst.data());
+
+    auto texel = [&](uint32_t x, uint32_t y, int c) {
+        return static_cast<uint32_t>(src[(std::min(y, height - 1) * width + std::min(x, width - 1)) * 4 + c]);
+    };
+    for (uint32_t y = 0; y < 2; ++y) {
+        for (uint32_t x = 0; x < 5; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                const uint32_t sum = texel(x * 2, y * 2, c) + texel(x * 2 + 1, y * 2, c) +
+                                     texel(x * 2, y * 2 + 1, c) + texel(x * 2 + 1, y * 2 + 1, c);
+                REQUIRE(dst[(y * 5 + x) * 4 + c] == (sum + 2) / 4);
+            }
+        }
+    }
+}
+
+TEST_CASE("downsampleBox handles single-texel edges", "[image][rendering]") {
+    const std::vector<uint8_t> src = {10, 20, 30, 40, 30, 40, 50, 60};  // 1x2
+    std::vector<uint8_t> dst(4);
+
+    downsampleBox(src.data(), 1, 2, dst.data());
+
+    REQUIRE(dst == std::vector<uint8_t>{20, 30, 40, 50});
+}
+
+TEST_CASE("buildMipChain produces every level down to 1x1", "[image][rendering]") {
+    REQUIRE(computeMipCount(1, 1) == 1);
+    REQUIRE(computeMipCount(256, 64) == 9);
+    REQUIRE(computeMipCount(5, 3) == 3);
+    REQUIRE(computeMipChainSize(4, 2) == (8 + 2 + 1) * 4);
+
+    std::vector<uint8_t> base(4 * 2 * 4, 0);
+    for (size_t i = 0; i < base.size(); i += 4) {
+        base[i] = 200;
+        base[i + 3] = 255;
+    }
+
+    const std::vector<uint8_t> chain = buildMipChain(base.data(), 4, 2);
+
+    REQUIRE(chain.size() == computeMipChainSize(4, 2));
+    REQUIRE(std::equal(base.begin(), base.end(), chain.begin()));
+    // Uniform image stays uniform; last level is the 1x1 average
+    REQUIRE(chain[chain.size() - 4] == 200);
+    REQUIRE(chain[chain.size() - 1] == 255);
+}
@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include "rendering/render_graph.h"
+#include <algorithm>
+
+using namespace Engine;
+
+namespace {
+
+RenderPassDesc makePass(const std::string& name, RenderResourceId target,
+                        std::vector<RenderResourceId> reads = {}) {
+    RenderPassDesc desc;
+    desc.name = name;
+    desc.target = target;
+    desc.reads = std::move(reads);
+    return desc;
+}
+
+size_t positionOf(const RenderGraph& graph, RenderPassId pass) {
+    const auto& order = graph.getExecutionOrder();
+    return static_cast<size_t>(std::find(order.begin(), order.end(), pass) - order.begin());
+}
+
+} // namespace
+
+TEST_CASE("RenderGraph orders passes by their targets", "[rendergraph][rendering]") {
+    RenderGraph graph(1);
+    RenderResourceId scene = graph.createTarget("scene", {});
+    RenderResourceId lights = graph.createTarget("lights", {});
+
+    // Producers declared after their consumers on purpose; passes sharing a
+    // target (post and ui on the backbuffer) keep their declaration order.
+    RenderPassId post = graph.addPass(makePass("post", kBackbuffer, {scene, lights}));
+    RenderPassId lighting = graph.addPass(makePass("lighting", lights, {scene}));
+    RenderPassId ui = graph.addPass(makePass("ui", kBackbuffer));
+    RenderPassId world = graph.addPass(makePass("world", scene));
+
+    REQUIRE(graph.compile(1280, 720));
+    REQUIRE(graph.getExecutionOrder().size() == 4);
+    REQUIRE(positionOf(graph, world) < positionOf(graph, lighting));
+    REQUIRE(positionOf(graph, lighting) < positionOf(graph, post));
+    REQUIRE(positionOf(graph, post) < positionOf(graph, ui));
+
+    // View ids are consecutive from the first id, in execution order
+    for (size_t i = 0; i < graph.getExecutionOrder().size(); ++i) {
+        REQUIRE(graph.getViewId(graph.getExecutionOrder()[i]) == 1 + i);
+    }
+}
+
+TEST_CASE("RenderGraph culls passes nobody consumes", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderResourceId scene = graph.createTarget("scene", {});
+    RenderResourceId debug = graph.createTarget("debug", {});
+
+    RenderPassId world = graph.addPass(makePass("world", scene));
+    RenderPassId debugPass = graph.addPass(makePass("debug", debug));
+    RenderPassId present = graph.addPass(makePass("present", kBackbuffer, {scene}));
+
+    REQUIRE(graph.compile(800, 600));
+    REQUIRE_FALSE(graph.isPassCulled(world));
+    REQUIRE_FALSE(graph.isPassCulled(present));
+    REQUIRE(graph.isPassCulled(debugPass));
+    REQUIRE(graph.getExecutionOrder().size() == 2);
+    REQUIRE(graph.getPhysicalTargetIndex(debug) == UINT32_MAX);
+
+    SECTION("keepAlive overrides culling") {
+        RenderPassDesc capture = makePass("capture", debug);
+        capture.keepAlive = true;
+        RenderPassId capturePass = graph.addPass(capture);
+        REQUIRE(graph.compile(800, 600));
+        REQUIRE_FALSE(graph.isPassCulled(capturePass));
+        REQUIRE(graph.isPassCulled(debugPass));  // Still nothing reads its output
+        REQUIRE(graph.isCompiled());
+    }
+}
+
+TEST_CASE("RenderGraph aliases targets with disjoint lifetimes", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderResourceId a = graph.createTarget("a", {});
+    RenderResourceId b = graph.createTarget("b", {});
+    RenderResourceId c = graph.createTarget("c", {});
+    RenderTargetDesc half;
+    half.scale = 0.5f;
+    RenderResourceId small = graph.createTarget("small", half);
+
+    // a -> b -> c -> backbuffer: a is dead once b is written, so c can reuse a.
+    graph.addPass(makePass("write a", a));
+    graph.addPass(makePass("a to b", b, {a}));
+    graph.addPass(makePass("b to c", c, {b}));
+    graph.addPass(makePass("c to small", small, {c}));
+    graph.addPass(makePass("present", kBackbuffer, {small}));
+
+    REQUIRE(graph.compile(1024, 768));
+    REQUIRE(graph.getPhysicalTargetIndex(a) == graph.getPhysicalTargetIndex(c));
+    REQUIRE(graph.getPhysicalTargetIndex(a) != graph.getPhysicalTargetIndex(b));
+    // Different size never aliases
+    REQUIRE(graph.getPhysicalTargetIndex(small) != graph.getPhysicalTargetIndex(b));
+    REQUIRE(graph.getPhysicalTargetCount() == 3);
+}
+
+TEST_CASE("RenderGraph rejects cycles", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderPassId first = graph.addPass(makePass("first", kBackbuffer));
+    RenderPassId second = graph.addPass(makePass("second", kBackbuffer));
+    graph.addDependency(second, first);  // Contradicts the implicit backbuffer order
+
+    REQUIRE_FALSE(graph.compile(640, 480));
+    REQUIRE_FALSE(graph.isCompiled());
+    REQUIRE(graph.getExecutionOrder().empty());
+}
+
+TEST_CASE("RenderGraph rejects passes writing unknown targets", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderResourceId scene = graph.createTarget("scene", {});
+    graph.addPass(makePass("world", scene));
+    graph.addPass(makePass("stray", scene + 1));
+    graph.addPass(makePass("present", kBackbuffer, {scene}));
+
+    REQUIRE_FALSE(graph.compile(640, 480));
+    REQUIRE_FALSE(graph.isCompiled());
+    REQUIRE(graph.getExecutionOrder().empty());
+
+    graph.execute(640, 480);  // Compiles again, fails and draws nothing
+    REQUIRE_FALSE(graph.isCompiled());
+}
+
+TEST_CASE("RenderGraph links reads to the latest earlier write", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderResourceId t1 = graph.createTarget("t1", {});
+    RenderResourceId t2 = graph.createTarget("t2", {});
+
+    // Ping-pong: t1 -> t2 -> t1 is a chain of versions, not a cycle.
+    RenderPassId scene = graph.addPass(makePass("scene", t1));
+    RenderPassId blurH = graph.addPass(makePass("blurH", t2, {t1}));
+    RenderPassId blurV = graph.addPass(makePass("blurV", t1, {t2}));
+    RenderPassId present = graph.addPass(makePass("present", kBackbuffer, {t1}));
+
+    REQUIRE(graph.compile(1280, 720));
+    REQUIRE(graph.getExecutionOrder() == std::vector<RenderPassId>{scene, blurH, blurV, present});
+    // Both targets are live across the blur, so they cannot share memory
+    REQUIRE(graph.getPhysicalTargetIndex(t1) != graph.getPhysicalTargetIndex(t2));
+
+    SECTION("a later writer waits for earlier readers") {
+        RenderResourceId out = graph.createTarget("out", {});
+        RenderPassId overwritePass = graph.addPass(makePass("overwrite", t2));
+        RenderPassId copy = graph.addPass(makePass("copy", out, {t2}));
+        RenderPassId show = graph.addPass(makePass("show", kBackbuffer, {out}));
+
+        REQUIRE(graph.compile(1280, 720));
+        REQUIRE(positionOf(graph, blurV) < positionOf(graph, overwritePass));
+        REQUIRE(positionOf(graph, overwritePass) < positionOf(graph, copy));
+        REQUIRE(positionOf(graph, copy) < positionOf(graph, show));
+    }
+}
+
+TEST_CASE("RenderGraph culls overwritten versions", "[rendergraph][rendering]") {
+    RenderGraph graph;
+    RenderResourceId target = graph.createTarget("target", {});
+    RenderResourceId history = graph.createTarget("history", {});
+
+    RenderPassId stale = graph.addPass(makePass("stale", target));
+    RenderPassId fresh = graph.addPass(makePass("fresh", target));  // Replaces "stale"
+    RenderPassId overlay = graph.addPass(makePass("overlay", target, {target}));  // Draws on top of "fresh"
+    RenderPassId present = graph.addPass(makePass("present", kBackbuffer, {target, history}));
+
+    REQUIRE(graph.compile(640, 480));
+    REQUIRE(graph.isPassCulled(stale));
+    REQUIRE_FALSE(graph.isPassCulled(fresh));
+    REQUIRE_FALSE(graph.isPassCulled(overlay));
+    REQUIRE(positionOf(graph, fresh) < positionOf(graph, overlay));
+    REQUIRE(positionOf(graph, overlay) < positionOf(graph, present));
+
+    // Never written inside the graph: keeps its own target
+    REQUIRE(graph.getPhysicalTargetIndex(history) != graph.getPhysicalTargetIndex(target));
+    REQUIRE(graph.getPhysicalTargetCount() == 2);
+}
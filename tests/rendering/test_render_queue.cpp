@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "rendering/render_queue.h"
+#include "rendering/camera.h"
 
 using namespace Engine;
 using Catch::Approx;
@@ -23,6 +24,15 @@ struct RecordingBatch {
     void end() {}
 };
 
+struct AffineRecordingBatch {
+    std::vector<Affine2D> drawn;
+
+    void begin(const Mat4&) { drawn.clear(); }
+    void draw(const SpriteDrawData&) { FAIL("Affine batch should not receive SpriteDrawData"); }
+    void draw(const SpriteDrawData&, const Affine2D& transform) { drawn.push_back(transform); }
+    void end() {}
+};
+
 SpriteDrawData createTestSprite(const Vec2& size = Vec2(16.0f, 16.0f), const Color& color = Color::White) {
     SpriteDrawData data{};
     data.texture = BGFX_INVALID_HANDLE; // We do not need a valid GPU handle for unit tests
@@ -402,4 +412,187 @@ TEST_CASE("RenderQueue reusability", "[renderqueue][rendering]") {
     
     REQUIRE(queue.size() == 2);
     REQUIRE(batch.drawn.size() == 2);
-}
\ No newline at end of file
+}
+TEST_CASE("RenderQueue submits affines to affine-capable batches", "[renderqueue][rendering]") {
+    RenderQueue queue;
+
+    Transform camera;
+    camera.position = {100.0f, 50.0f};
+    queue.setCameraTransform(camera);
+
+    Transform transform;
+    transform.position = {200.0f, 150.0f};
+    transform.rotation = 90.0f;
+    transform.scale = {2.0f, 2.0f};
+
+    queue.submit(10.0f, createTestSprite(), transform);
+    queue.sort();
+
+    AffineRecordingBatch batch;
+    queue.render(batch, kIdentityViewProj);
+
+    REQUIRE(batch.drawn.size() == 1);
+    const Affine2D& affine = batch.drawn[0];
+    REQUIRE(affine.tx == Approx(100.0f));
+    REQUIRE(affine.ty == Approx(100.0f));
+
+    // Local +X maps to screen +Y, scaled by 2
+    Vec2 edge = affine.applyVector(Vec2(1.0f, 0.0f));
+    REQUIRE(edge.x == Approx(0.0f).margin(0.001f));
+    REQUIRE(edge.y == Approx(2.0f));
+}
+
+TEST_CASE("RenderQueue culls with rotation-aware bounds", "[renderqueue][rendering]") {
+    RenderQueue queue;
+    queue.enableCulling(true);
+    queue.setCullingBounds(Rectangle(0.0f, 0.0f, 100.0f, 100.0f));
+
+    // 200x10 bar with a centred origin
+    SpriteDrawData bar = createTestSprite(Vec2(200.0f, 10.0f));
+    bar.origin = Vec2(100.0f, 5.0f);
+
+    SECTION("Rotated bar reaching into view is kept") {
+        Transform transform;
+        transform.position = {50.0f, -60.0f};  // Unrotated, the bar lies above the view
+        transform.rotation = 90.0f;             // Rotated, it spans y -160..40
+
+        queue.submit(10.0f, bar, transform);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 0);
+    }
+
+    SECTION("Rotated bar outside view is culled") {
+        Transform transform;
+        transform.position = {150.0f, 50.0f};  // Unrotated, the bar overlaps the view
+        transform.rotation = 90.0f;             // Rotated, it is a thin line at x 145..155
+
+        queue.submit(10.0f, bar, transform);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 1);
+    }
+
+    SECTION("Scaled origin shifts the bounds") {
+        SpriteDrawData sprite = createTestSprite(Vec2(10.0f, 10.0f));
+        sprite.origin = Vec2(10.0f, 10.0f);  // Bottom-right pivot
+
+        Transform transform;
+        transform.position = {-1.0f, 50.0f};
+        transform.scale = {4.0f, 4.0f};  // Covers x -41..-1, entirely left of the view
+
+        queue.submit(10.0f, sprite, transform);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 1);
+    }
+}
+
+TEST_CASE("RenderQueue culls through the camera view transform", "[renderqueue][rendering]") {
+    RenderQueue queue;
+    queue.enableCulling(true);
+    queue.setCullingBounds(Rectangle(0.0f, 0.0f, 800.0f, 600.0f));
+
+    Transform near;
+    near.position = {1000.0f, 100.0f};
+    queue.submit(10.0f, createTestSprite(), near);
+
+    Camera camera(Vec2(0.0f, 0.0f), Vec2(800.0f, 600.0f));
+
+    SECTION("Default zoom: off screen") {
+        queue.setCamera(camera);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 1);
+    }
+
+    SECTION("Zoomed out: on screen and drawn at the scaled position") {
+        camera.setZoom(2.0f);
+        queue.setCamera(camera);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 0);
+        REQUIRE(batch.drawn.size() == 1);
+        REQUIRE(batch.drawn[0].position.x == Approx(500.0f));
+        REQUIRE(batch.drawn[0].size.x == Approx(8.0f));
+    }
+
+    SECTION("Camera rotation moves items into view") {
+        camera.setRotation(-90.0f);  // Rotates world +X onto screen +Y
+        queue.setCamera(camera);
+        RecordingBatch batch;
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 1);  // Lands at y 1000, still off screen
+
+        Transform below;
+        below.position = {300.0f, -400.0f};
+        queue.submit(10.0f, createTestSprite(), below);  // Rotates to (400, 300)
+        queue.render(batch, kIdentityViewProj);
+        REQUIRE(queue.getCulledCount() == 1);
+        REQUIRE(batch.drawn.size() == 1);
+    }
+}
+
+TEST_CASE("RenderQueue groups equal depths by shader variant and texture", "[renderqueue][rendering]") {
+    RenderQueue queue;
+    Transform transform;
+
+    SpriteDrawData textured = createTestSprite();
+    textured.texture.idx = 1;
+    SpriteDrawData otherTexture = textured;
+    otherTexture.texture.idx = 2;
+    SpriteDrawData solid = createTestSprite();
+    solid.texture.idx = 3;  // Ignored by the solid variant
+    solid.features = SpriteShaderFeature::Solid;
+    SpriteDrawData far = textured;
+    far.features = SpriteShaderFeature::Solid;
+
+    queue.submit(1.0f, solid, transform);
+    queue.submit(1.0f, textured, transform);
+    queue.submit(1.0f, otherTexture, transform);
+    queue.submit(5.0f, far, transform);
+    queue.submit(1.0f, textured, transform);
+    queue.submit(1.0f, solid, transform);
+    queue.sort();
+
+    RecordingBatch batch;
+    queue.render(batch, kIdentityViewProj);
+    REQUIRE(batch.drawn.size() == 6);
+
+    // Depth still wins over batching
+    REQUIRE(batch.drawn[0].features == SpriteShaderFeature::Solid);
+    REQUIRE(batch.drawn[0].texture.idx == 1);
+
+    // Then plain textured sprites grouped by texture, then the solid ones
+    REQUIRE(batch.drawn[1].texture.idx == 1);
+    REQUIRE(batch.drawn[2].texture.idx == 1);
+    REQUIRE(batch.drawn[3].texture.idx == 2);
+    REQUIRE(batch.drawn[4].features == SpriteShaderFeature::Solid);
+    REQUIRE(batch.drawn[5].features == SpriteShaderFeature::Solid);
+}
+
+TEST_CASE("RenderQueue forwards extra begin arguments to the batch", "[renderqueue][rendering]") {
+    struct ViewBatch {
+        int view = -1;
+        void* encoder = nullptr;
+        size_t draws = 0;
+
+        void begin(const Mat4&, int viewId, void* target) {
+            view = viewId;
+            encoder = target;
+        }
+        void draw(const SpriteDrawData&) { ++draws; }
+        void end() {}
+    };
+
+    RenderQueue queue;
+    queue.submit(1.0f, createTestSprite(), Transform{});
+
+    int token = 0;
+    ViewBatch batch;
+    queue.render(batch, kIdentityViewProj, 3, static_cast<void*>(&token));
+
+    REQUIRE(batch.view == 3);
+    REQUIRE(batch.encoder == &token);
+    REQUIRE(batch.draws == 1);
+}
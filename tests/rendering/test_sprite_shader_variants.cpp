@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include "rendering/sprite_shader_variants.h"
+#include <set>
+#include <string>
+
+using namespace Engine;
+
+TEST_CASE("Sprite variant indices are dense and round-trip", "[spritevariants][rendering]") {
+    std::set<std::string> names;
+    for (uint32_t i = 0; i < kSpriteShaderVariantCount; ++i) {
+        const SpriteShaderFeature features = getSpriteVariantFeatures(i);
+        REQUIRE(getSpriteVariantIndex(features) == i);
+        REQUIRE(normalizeSpriteFeatures(features, true) == features);
+        names.insert(getSpriteFragmentName(i));
+    }
+    REQUIRE(names.size() == kSpriteShaderVariantCount);
+    REQUIRE(std::string(getSpriteFragmentName(0)) == "sprite.frag");
+    REQUIRE(std::string(getSpriteVariantDefines(0)).empty());
+}
+
+TEST_CASE("Sprite features normalize to the minimal variant", "[spritevariants][rendering]") {
+    using F = SpriteShaderFeature;
+
+    SECTION("Palette without a palette texture falls back to plain texturing") {
+        REQUIRE(normalizeSpriteFeatures(F::Palette, false) == F::None);
+        REQUIRE(normalizeSpriteFeatures(F::Palette | F::AlphaTest, false) == F::AlphaTest);
+        REQUIRE(normalizeSpriteFeatures(F::Palette, true) == F::Palette);
+    }
+
+    SECTION("Exclusive color sources resolve by priority") {
+        REQUIRE(normalizeSpriteFeatures(F::Solid | F::Flash | F::Palette, true) == F::Solid);
+        REQUIRE(normalizeSpriteFeatures(F::Flash | F::Palette, true) == F::Flash);
+    }
+
+    SECTION("Alpha test combines with any color source") {
+        const F features = normalizeSpriteFeatures(F::Solid | F::AlphaTest, false);
+        REQUIRE(features == (F::Solid | F::AlphaTest));
+        REQUIRE(std::string(getSpriteFragmentName(getSpriteVariantIndex(features))) == "sprite_solid_atest.frag");
+        REQUIRE(std::string(getSpriteVariantDefines(getSpriteVariantIndex(features))) == "SPRITE_SOLID;SPRITE_ALPHA_TEST");
+    }
+}
+
+TEST_CASE("Out-of-range sprite variants map to the base shader", "[spritevariants][rendering]") {
+    REQUIRE(getSpriteVariantFeatures(kSpriteShaderVariantCount) == SpriteShaderFeature::None);
+    REQUIRE(std::string(getSpriteFragmentName(kSpriteShaderVariantCount)) == "sprite.frag");
+}
+
+TEST_CASE("Vertex-color sprite variants output premultiplied color", "[spritevariants][rendering]") {
+    using F = SpriteShaderFeature;
+    REQUIRE(isPremultipliedSpriteVariant(getSpriteVariantIndex(F::Solid)));
+    REQUIRE(isPremultipliedSpriteVariant(getSpriteVariantIndex(F::Flash | F::AlphaTest)));
+    REQUIRE_FALSE(isPremultipliedSpriteVariant(getSpriteVariantIndex(F::None)));
+    REQUIRE_FALSE(isPremultipliedSpriteVariant(getSpriteVariantIndex(F::Palette)));
+}
@@ -2,6 +2,7 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include "rendering/texture_atlas.h"
+#include <algorithm>
 #include <fstream>
 #include <cstdio>
 
@@ -184,6 +185,20 @@ TEST_CASE("TextureAtlas handles manual animation addition", "[textureatlas][rend
     REQUIRE(retrieved->frame_duration == 0.15f);
 }
 
+TEST_CASE("TextureAtlas lists animation names into a frame arena", "[textureatlas][rendering]") {
+    TextureAtlas atlas;
+    atlas.add_frame(SpriteFrame("f0", glm::ivec4(0, 0, 16, 16)));
+    atlas.add_animation(AnimationData("walk", {"f0"}, 0.1f, true));
+    atlas.add_animation(AnimationData("idle", {"f0"}, 0.1f, true));
+
+    FrameAllocator arena(1024);
+    auto names = atlas.get_animation_names(arena);
+    REQUIRE(names.size() == 2);
+    REQUIRE(arena.getUsedBytes() == 2 * sizeof(std::string_view));
+    REQUIRE(std::find(names.begin(), names.end(), "walk") != names.end());
+    REQUIRE(std::find(names.begin(), names.end(), "idle") != names.end());
+}
+
 TEST_CASE("TextureAtlas validates animation frame references", "[textureatlas][rendering]") {
     TextureAtlas atlas;
     
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include "rendering/texture_registry.h"
+#include <chrono>
+#include <thread>
+
+using namespace Engine;
+
+// Missing files take the failed-load path, so no GPU is needed.
+
+TEST_CASE("TextureRegistry shares one entry per normalized path", "[texture_registry][rendering]") {
+    TextureRegistry registry;
+
+    TextureRef a = registry.load("missing/sprites/hero.png");
+    TextureRef b = registry.load("missing/sprites/../sprites/./hero.png");
+
+    REQUIRE(a == b);
+    REQUIRE(a.getPath() == "missing/sprites/hero.png");
+    REQUIRE(a.getState() == TextureLoadState::Failed);
+    REQUIRE_FALSE(bgfx::isValid(a.getHandle()));
+    REQUIRE(a.getTexture() == nullptr);
+    REQUIRE(registry.getTextureCount() == 1);
+
+    TextureRef other = registry.load("missing/sprites/villain.png");
+    REQUIRE_FALSE(other == a);
+    REQUIRE(registry.getTextureCount() == 2);
+}
+
+TEST_CASE("TextureRegistry counts references", "[texture_registry][rendering]") {
+    TextureRegistry registry;
+
+    TextureRef a = registry.load("missing/count.png");
+    REQUIRE(a.getRefCount() == 1);
+
+    TextureRef copy = a;
+    REQUIRE(a.getRefCount() == 2);
+
+    TextureRef moved = std::move(copy);
+    REQUIRE_FALSE(copy);
+    REQUIRE(a.getRefCount() == 2);
+
+    moved.reset();
+    REQUIRE(a.getRefCount() == 1);
+    REQUIRE(registry.getPendingReleaseCount() == 0);
+
+    a.reset();
+    REQUIRE_FALSE(a);
+    REQUIRE(registry.getPendingReleaseCount() == 1);
+    REQUIRE(registry.getTextureCount() == 1);  // Destroyed by update(), not reset()
+}
+
+TEST_CASE("TextureRegistry destroys textures destroyDelayFrames after release", "[texture_registry][rendering]") {
+    TextureRegistryConfig config;
+    config.destroyDelayFrames = 2;
+    TextureRegistry registry(config);
+
+    registry.load("missing/expire.png").reset();
+    REQUIRE(registry.getPendingReleaseCount() == 1);
+
+    registry.update();
+    registry.update();
+    REQUIRE(registry.getTextureCount() == 1);
+
+    registry.update();
+    REQUIRE(registry.getTextureCount() == 0);
+    REQUIRE(registry.getPendingReleaseCount() == 0);
+}
+
+TEST_CASE("TextureRegistry reuses entries re-acquired before expiry", "[texture_registry][rendering]") {
+    TextureRegistryConfig config;
+    config.destroyDelayFrames = 2;
+    TextureRegistry registry(config);
+
+    registry.load("missing/reuse.png").reset();
+    registry.update();
+
+    TextureRef again = registry.load("missing/reuse.png");
+    REQUIRE(again.getRefCount() == 1);
+    for (int i = 0; i < 4; ++i) {
+        registry.update();
+    }
+    REQUIRE(registry.getTextureCount() == 1);
+    REQUIRE(registry.getPendingReleaseCount() == 0);
+
+    SECTION("collect() skips the delay once released") {
+        again.reset();
+        registry.collect();
+        REQUIRE(registry.getTextureCount() == 0);
+    }
+}
+
+TEST_CASE("TextureRegistry resolves failed async loads in update()", "[texture_registry][rendering]") {
+    TextureRegistry registry;
+
+    TextureRef ref = registry.loadAsync("missing/async.png");
+    REQUIRE(ref.getState() != TextureLoadState::Ready);
+    for (int i = 0; i < 1000 && ref.getState() == TextureLoadState::Loading; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));  // The read runs on a worker
+        registry.update();
+    }
+    REQUIRE(ref.getState() == TextureLoadState::Failed);
+    REQUIRE(registry.getUploadCount() == 0);
+
+    // Cached until released: a second request does not retry the read.
+    TextureRef again = registry.loadAsync("missing/async.png");
+    REQUIRE(again == ref);
+    REQUIRE(again.getState() == TextureLoadState::Failed);
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include "rendering/texture_residency.h"
+
+using namespace Engine;
+
+TEST_CASE("TextureResidency tracks used bytes", "[residency][rendering]") {
+    TextureResidency residency(1000);
+
+    residency.insert(0, 300);
+    residency.insert(3, 200);
+    REQUIRE(residency.getUsedBytes() == 500);
+    REQUIRE(residency.getEntryCount() == 2);
+    REQUIRE(residency.contains(3));
+    REQUIRE_FALSE(residency.contains(1));
+
+    residency.insert(0, 100);  // Re-insert replaces size
+    REQUIRE(residency.getUsedBytes() == 300);
+
+    residency.erase(3);
+    residency.erase(3);
+    REQUIRE(residency.getUsedBytes() == 100);
+    REQUIRE(residency.getEntryCount() == 1);
+}
+
+TEST_CASE("TextureResidency evicts least recently drawn first", "[residency][rendering]") {
+    TextureResidency residency(250);
+    residency.insert(0, 100);
+    residency.insert(1, 100);
+    residency.insert(2, 100);
+
+    residency.beginFrame();
+    residency.markUsed(0);
+    residency.markUsed(2);
+    residency.beginFrame();
+
+    auto evicted = residency.evict();
+
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == 1);
+    REQUIRE(residency.getUsedBytes() == 200);
+    REQUIRE(residency.getEvictionCount() == 1);
+    REQUIRE(residency.getLastUsedFrame(0) == 1);
+}
+
+TEST_CASE("TextureResidency keeps recently drawn textures", "[residency][rendering]") {
+    TextureResidency residency(100);
+    residency.insert(0, 100);
+    residency.insert(1, 100);
+
+    // Both were drawn this frame and may still be referenced by the GPU.
+    REQUIRE(residency.evict(1).empty());
+    REQUIRE(residency.getUsedBytes() == 200);
+
+    residency.beginFrame();
+    residency.markUsed(1);
+    residency.beginFrame();
+    residency.beginFrame();
+
+    // Frame 3: 0 idle for three frames, 1 for two.
+    auto evicted = residency.evict(3);
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == 0);
+    REQUIRE(residency.contains(1));
+}
+
+TEST_CASE("TextureResidency does nothing within budget", "[residency][rendering]") {
+    TextureResidency residency(1000);
+    residency.insert(0, 400);
+    residency.beginFrame();
+    residency.beginFrame();
+
+    REQUIRE(residency.evict().empty());
+
+    residency.setBudget(100);
+    auto evicted = residency.evict();
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(residency.getUsedBytes() == 0);
+}
+
+TEST_CASE("TextureResidency prefers larger textures among equally old ones", "[residency][rendering]") {
+    TextureResidency residency(300);
+    residency.insert(0, 100);
+    residency.insert(1, 300);
+    residency.insert(2, 100);
+    residency.beginFrame();
+
+    auto evicted = residency.evict();
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == 1);
+}
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Compress PNG textures to GPU formats (.ktx with full mip chains).
+
+Usage:
+    compress_textures.py images/*.png [--formats bc7,bc3,etc2a] [--texturec PATH] [--no-mips] [--pma]
+
+For every input "dir/name.png" this writes "dir/name.<format>.ktx" next to
+it. Texture::loadFromFile("dir/name.png") picks the best variant the GPU
+supports and falls back to the PNG otherwise, so the PNG should be kept.
+
+--pma bakes premultiplied alpha into "dir/name.<format>.pma.ktx"; those are
+only picked for loads with TextureLoadOptions::premultiplyAlpha, and plain
+.ktx files only for straight-alpha loads. Run both ways if a texture is
+loaded in both modes. Never use --pma for palette index textures.
+
+Uses bgfx's texturec, which the engine build produces when BGFX_BUILD_TOOLS
+is on. Pass --texturec if it is not in the default build directory.
+"""
+import os
+import shutil
+import subprocess
+import sys
+
+# Suffix used in the output name -> texturec format name
+FORMATS = {
+    "bc7": "BC7",
+    "bc3": "BC3",
+    "bc1": "BC1",
+    "astc4x4": "ASTC4x4",
+    "etc2a": "ETC2A",
+    "etc2": "ETC2",
+}
+DEFAULT_FORMATS = ["bc7", "bc3", "etc2a"]
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SEARCH_PATHS = [
+    os.path.join(ROOT, "build", "_deps", "bgfx.cmake-build", "cmake", "bimg", "texturec"),
+    os.path.join(ROOT, "build", "_deps", "bgfx.cmake-build", "cmake", "bgfx", "texturec"),
+]
+
+
+def parse_args(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    formats = DEFAULT_FORMATS
+    texturec = None
+    mips = True
+    pma = False
+    inputs = []
+    args = iter(argv[1:])
+    for arg in args:
+        if arg == "--formats":
+            formats = [f.strip().lower() for f in next(args).split(",")]
+        elif arg == "--texturec":
+            texturec = next(args)
+        elif arg == "--no-mips":
+            mips = False
+        elif arg == "--pma":
+            pma = True
+        else:
+            inputs.append(arg)
+    for fmt in formats:
+        if fmt not in FORMATS:
+            print(f"Unknown format '{fmt}' (expected one of {', '.join(FORMATS)})")
+            sys.exit(1)
+    return inputs, formats, texturec, mips, pma
+
+
+def find_texturec(override):
+    if override:
+        return override
+    for path in SEARCH_PATHS:
+        for candidate in (path, path + ".exe"):
+            if os.path.isfile(candidate):
+                return candidate
+    return shutil.which("texturec")
+
+
+def main():
+    inputs, formats, texturec, mips, pma = parse_args(sys.argv)
+    texturec = find_texturec(texturec)
+    if not texturec:
+        print("texturec not found; build with BGFX_BUILD_TOOLS=ON or pass --texturec")
+        sys.exit(1)
+
+    failed = 0
+    for path in inputs:
+        stem = os.path.splitext(path)[0]
+        for fmt in formats:
+            output = f"{stem}.{fmt}.pma.ktx" if pma else f"{stem}.{fmt}.ktx"
+            cmd = [texturec, "-f", path, "-o", output, "-t", FORMATS[fmt], "-q", "default"]
+            if mips:
+                cmd.append("-m")
+            if pma:
+                cmd.append("--pma")
+            result = subprocess.run(cmd, capture_output=True, text=True)
+            if result.returncode != 0:
+                print(f"FAILED {output}: {result.stderr.strip() or result.stdout.strip()}")
+                failed += 1
+                continue
+            print(f"Wrote {output} ({os.path.getsize(output)} bytes)")
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""Pack audio files into a sound bank (.sbnk) for AudioEngine::loadSoundBank.
+
+Usage:
+    pack_sound_bank.py out.sbnk sfx/*.wav [--compressed music/*.ogg] [--lazy rare/*.wav]
+
+Clip names are file paths relative to --root (default: current directory)
+without extension. Files after --compressed stay encoded in memory and are
+decoded while playing; files after --lazy are decoded on first play.
+Everything else is decoded when the bank loads.
+"""
+import os
+import struct
+import sys
+
+MAGIC = b"SBNK"
+VERSION = 1
+FLAG_COMPRESSED = 1 << 0
+FLAG_PRELOAD = 1 << 1
+
+
+def parse_args(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+    output = argv[1]
+    root = "."
+    mode = FLAG_PRELOAD
+    inputs = []
+    args = iter(argv[2:])
+    for arg in args:
+        if arg == "--compressed":
+            mode = FLAG_COMPRESSED
+        elif arg == "--lazy":
+            mode = 0
+        elif arg == "--root":
+            root = next(args)
+        else:
+            inputs.append((arg, mode))
+    return output, root, inputs
+
+
+def clip_name(path, root):
+    rel = os.path.relpath(path, root)
+    return os.path.splitext(rel)[0].replace(os.sep, "/")
+
+
+def main():
+    output, root, inputs = parse_args(sys.argv)
+
+    clips = []
+    for path, flags in inputs:
+        with open(path, "rb") as f:
+            clips.append((clip_name(path, root).encode("utf-8"), flags, f.read()))
+
+    header_size = 12 + sum(2 + len(name) + 1 + 4 + 4 for name, _, _ in clips)
+    offset = header_size
+    table = b""
+    for name, flags, data in clips:
+        table += struct.pack("<H", len(name)) + name + struct.pack("<BII", flags, offset, len(data))
+        offset += len(data)
+
+    with open(output, "wb") as f:
+        f.write(MAGIC + struct.pack("<II", VERSION, len(clips)))
+        f.write(table)
+        for _, _, data in clips:
+            f.write(data)
+
+    print(f"Packed {len(clips)} clips into {output} ({offset} bytes)")
+
+
+if __name__ == "__main__":
+    main()